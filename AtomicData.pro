@@ -1,28 +1,13 @@
-QT       += core gui
+# Builds the core library and every program which links against it
 
-greaterThan(QT_MAJOR_VERSION, 4): QT += widgets network printsupport
+TEMPLATE = subdirs
 
-CONFIG += c++11
+SUBDIRS += \
+    core \
+    app \
+    cli \
+    benchmarks
 
-# You can make your code fail to compile if it uses deprecated APIs.
-# In order to do so, uncomment the following line.
-#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
-
-SOURCES += \
-    atom.cpp \
-    main.cpp \
-    atomicdata.cpp \
-    qcustomplot.cpp
-
-HEADERS += \
-    atom.h \
-    atomicdata.h \
-    qcustomplot.h
-
-FORMS += \
-    atomicdata.ui
-
-# Default rules for deployment.
-qnx: target.path = /tmp/$${TARGET}/bin
-else: unix:!android: target.path = /opt/$${TARGET}/bin
-!isEmpty(target.path): INSTALLS += target
+app.depends = core
+cli.depends = core
+benchmarks.depends = core
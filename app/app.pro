@@ -0,0 +1,37 @@
+QT       += core gui
+
+greaterThan(QT_MAJOR_VERSION, 4): QT += widgets network printsupport
+
+TARGET = AtomicData
+
+CONFIG += c++17
+
+# You can make your code fail to compile if it uses deprecated APIs.
+# In order to do so, uncomment the following line.
+#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
+
+# nuclide store, parsers and calculations
+include(../core/core.pri)
+
+SOURCES += \
+    main.cpp \
+    atomicdata.cpp \
+    colorizekernel.cpp \
+    nuclidetablemodel.cpp \
+    segrechart.cpp \
+    qcustomplot.cpp
+
+HEADERS += \
+    atomicdata.h \
+    colorizekernel.h \
+    nuclidetablemodel.h \
+    segrechart.h \
+    qcustomplot.h
+
+FORMS += \
+    atomicdata.ui
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
@@ -0,0 +1,512 @@
+#include "atomicdata.h"
+#include "ui_atomicdata.h"
+#include <algorithm>
+#include <cmath>
+
+//#define DEBUG
+
+AtomicData::AtomicData(QWidget *parent)
+    : QMainWindow(parent)
+    , ui(new Ui::AtomicData)
+    , nuclides_(new NuclideTable)
+    , useAccurate_(true)
+    , loader_(nullptr)
+{
+    ui->setupUi(this);
+
+    /* make debug tab invisible if in debug mode*/
+    #ifndef DEBUG
+    ui->tabWidget->removeTab(ui->tabWidget->indexOf(ui->tab_debug));
+    ui->checkBox->setChecked(false);
+    this->useAccurate_ = ui->checkBox->isChecked();
+    //ui->checkBox->hide();
+    #endif
+
+    /* set up labels */
+    this->showConstants();
+
+    /* set up table for displaying all of the nuclear data - rows share one height so the view never measures them */
+    ui->tableView->setModel(&this->nuclideModel_);
+    ui->tableView->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+    ui->tableView->verticalHeader()->setDefaultSectionSize(ui->tableView->fontMetrics().height() + 6);
+    ui->tableView->horizontalHeader()->setSectionResizeMode(QHeaderView::Interactive);
+
+    /* sorting switches between orders worked out when the table is loaded - start in table order */
+    ui->tableView->setSortingEnabled(true);
+    ui->tableView->sortByColumn(ColumnNucleons, Qt::AscendingOrder);
+
+    /* refilter the data table whenever a filter control changes */
+    connect(ui->lineEditFilterElement, &QLineEdit::textChanged, this, &AtomicData::applyDataFilter);
+    for (QSpinBox *spinBox : {ui->spinBoxFilterMinimumProtons, ui->spinBoxFilterMaximumProtons,
+                              ui->spinBoxFilterMinimumNeutrons, ui->spinBoxFilterMaximumNeutrons,
+                              ui->spinBoxFilterMinimumNucleons, ui->spinBoxFilterMaximumNucleons})
+        connect(spinBox, QOverload<int>::of(&QSpinBox::valueChanged), this, &AtomicData::applyDataFilter);
+    for (QDoubleSpinBox *spinBox : {ui->doubleSpinBoxFilterMinimumBindingEnergy, ui->doubleSpinBoxFilterMaximumBindingEnergy})
+        connect(spinBox, QOverload<double>::of(&QDoubleSpinBox::valueChanged), this, &AtomicData::applyDataFilter);
+    connect(ui->checkBoxFilterMeasured, &QCheckBox::toggled, this, &AtomicData::applyDataFilter);
+
+    /* the chart of nuclides keeps one colour map and recolours it */
+    this->segreChart_.reset(new SegreChart(ui->customPlotChart));
+
+    /* the calculator, data and graph come alive once the nuclides have been loaded */
+    ui->pushButtonCalculate->setEnabled(false);
+    ui->tabWidget->setTabEnabled(ui->tabWidget->indexOf(ui->tab_data), false);
+    ui->tabWidget->setTabEnabled(ui->tabWidget->indexOf(ui->tab_graph), false);
+    ui->tabWidget->setTabEnabled(ui->tabWidget->indexOf(ui->tab_chart), false);
+    ui->statusbar->showMessage("Loading nuclear data...");
+
+    /* load the nuclides on a worker thread so the window appears straight away */
+    NuclideLoader *loader = new NuclideLoader;
+    loader->moveToThread(&this->loaderThread_);
+    connect(&this->loaderThread_, &QThread::started, loader, &NuclideLoader::load);
+    connect(&this->loaderThread_, &QThread::finished, loader, &QObject::deleteLater);
+    connect(loader, &NuclideLoader::progress, this, &AtomicData::onLoadProgress);
+    connect(loader, &NuclideLoader::loaded, this, &AtomicData::onNuclidesLoaded);
+    connect(loader, &NuclideLoader::failed, this, &AtomicData::onLoadFailed);
+    this->loader_ = loader;
+    this->loaderThread_.start();
+}
+
+/* destructor */
+AtomicData::~AtomicData()
+{
+    this->loaderThread_.quit();
+    this->loaderThread_.wait();
+    delete ui;
+}
+
+/* function called on the gui thread while the loader is parsing */
+void AtomicData::onLoadProgress(int nuclides)
+{
+    ui->statusbar->showMessage(QString("Loading nuclear data... %1 nuclides").arg(nuclides));
+}
+
+/* function called once the loader has finished - take the nuclide table and bring up the ui */
+void AtomicData::onNuclidesLoaded(int nuclides)
+{
+    this->nuclides_ = this->loader_->takeTable();
+    this->index_.build(*this->nuclides_);
+    this->computeSeparationEnergies();
+    ui->statusbar->showMessage(QString("Loaded %1 nuclides").arg(nuclides), 5000);
+
+    /* the calculator is ready */
+    ui->pushButtonCalculate->setEnabled(true);
+
+    /* plot a graph */
+    plotGraph();
+    ui->tabWidget->setTabEnabled(ui->tabWidget->indexOf(ui->tab_graph), true);
+
+    /* build the chart grid once, then colour it */
+    this->segreChart_->setTable(this->nuclides_.get());
+    plotSegreChart();
+    ui->tabWidget->setTabEnabled(ui->tabWidget->indexOf(ui->tab_chart), true);
+
+    /* the data table formats its cells as they are scrolled into view */
+    this->nuclideModel_.setTable(this->nuclides_.get());
+    ui->tabWidget->setTabEnabled(ui->tabWidget->indexOf(ui->tab_data), true);
+}
+
+/* function called if the nuclides could not be loaded */
+void AtomicData::onLoadFailed(const QString &message)
+{
+    ui->statusbar->showMessage("Could not load nuclear data: " + message);
+}
+
+/* read the filter controls and refilter the data table - an unknown element symbol shows nothing */
+void AtomicData::applyDataFilter()
+{
+    NuclideFilter filter;
+    filter.minimumProtons = ui->spinBoxFilterMinimumProtons->value();
+    filter.maximumProtons = ui->spinBoxFilterMaximumProtons->value();
+    filter.minimumNeutrons = ui->spinBoxFilterMinimumNeutrons->value();
+    filter.maximumNeutrons = ui->spinBoxFilterMaximumNeutrons->value();
+    filter.minimumNucleons = ui->spinBoxFilterMinimumNucleons->value();
+    filter.maximumNucleons = ui->spinBoxFilterMaximumNucleons->value();
+    filter.minimumBindingEnergy = ui->doubleSpinBoxFilterMinimumBindingEnergy->value();
+    filter.maximumBindingEnergy = ui->doubleSpinBoxFilterMaximumBindingEnergy->value();
+    if (ui->checkBoxFilterMeasured->isChecked()) filter.excludedFlags = NuclideEstimated | NuclideExtrapolated;
+
+    const QString symbol = ui->lineEditFilterElement->text().trimmed();
+    if (!symbol.isEmpty()) {
+        const QString normalised = symbol.left(1).toUpper() + symbol.mid(1).toLower();
+        filter.element = elementSymbolId(normalised.toLatin1().constData());
+        if (filter.element < 0) filter.maximumProtons = -1;
+    }
+    this->nuclideModel_.setFilter(filter);
+}
+
+/* put every filter control back to showing all nuclides */
+void AtomicData::on_pushButtonFilterReset_clicked()
+{
+    const QSignalBlocker blockElement(ui->lineEditFilterElement);
+    ui->lineEditFilterElement->clear();
+    for (QSpinBox *spinBox : {ui->spinBoxFilterMinimumProtons, ui->spinBoxFilterMinimumNeutrons, ui->spinBoxFilterMinimumNucleons}) {
+        const QSignalBlocker block(spinBox);
+        spinBox->setValue(spinBox->minimum());
+    }
+    for (QSpinBox *spinBox : {ui->spinBoxFilterMaximumProtons, ui->spinBoxFilterMaximumNeutrons, ui->spinBoxFilterMaximumNucleons}) {
+        const QSignalBlocker block(spinBox);
+        spinBox->setValue(spinBox->maximum());
+    }
+    const QSignalBlocker blockMinimum(ui->doubleSpinBoxFilterMinimumBindingEnergy);
+    const QSignalBlocker blockMaximum(ui->doubleSpinBoxFilterMaximumBindingEnergy);
+    const QSignalBlocker blockMeasured(ui->checkBoxFilterMeasured);
+    ui->doubleSpinBoxFilterMinimumBindingEnergy->setValue(ui->doubleSpinBoxFilterMinimumBindingEnergy->minimum());
+    ui->doubleSpinBoxFilterMaximumBindingEnergy->setValue(ui->doubleSpinBoxFilterMaximumBindingEnergy->maximum());
+    ui->checkBoxFilterMeasured->setChecked(false);
+    applyDataFilter();
+}
+
+/* plot the graph selected on the graph tab */
+void AtomicData::plotGraph()
+{
+    ui->customPlot->clearGraphs();
+    ui->comboBoxSemfSubset->setEnabled(ui->comboBoxGraph->currentIndex() == 1);
+    if (ui->comboBoxGraph->currentIndex() == 1) plotSemfResiduals(ui->customPlot);
+    else plotNuclearData(ui->customPlot);
+    ui->customPlot->replot();
+}
+
+/* switch between the graphs */
+void AtomicData::on_comboBoxGraph_currentIndexChanged(int /* index */)
+{
+    if (!this->nuclides_->empty()) plotGraph();
+}
+
+/* refit the liquid drop model to another subset */
+void AtomicData::on_comboBoxSemfSubset_currentIndexChanged(int /* index */)
+{
+    if (this->nuclides_->empty()) return;
+    plotGraph();
+    if (ui->comboBoxChartQuantity->currentIndex() == ChartSemfResidual) plotSegreChart();
+}
+
+/* recolour the chart of nuclides */
+void AtomicData::on_comboBoxChartQuantity_currentIndexChanged(int /* index */)
+{
+    if (!this->nuclides_->empty()) plotSegreChart();
+}
+
+/* returns the nuclides fitted for each entry of the subset combo box */
+static SemfFilter semfSubset(int index)
+{
+    SemfFilter filter;
+    switch (index) {
+    case 1: filter.parity = SemfEvenEven; break;
+    case 2: filter.minimumNucleons = 41; break;
+    case 3: filter.parity = SemfEvenEven; filter.minimumNucleons = 41; break;
+    case 4: filter.excludeEstimated = true; break;
+    default: break;
+    }
+    return filter;
+}
+
+/* fit the liquid drop model and plot the residuals against nucleon number */
+void AtomicData::plotSemfResiduals(QCustomPlot *customPlot)
+{
+    const NuclideTable &nuclides = *this->nuclides_;
+    const SemfFilter filter = semfSubset(ui->comboBoxSemfSubset->currentIndex());
+    if (!this->semfFit_.fit(nuclides, filter)) {
+        ui->statusbar->showMessage("Too few nuclides to fit the liquid drop model", 5000);
+        return;
+    }
+    std::vector<double> residuals(nuclides.size());
+    this->semfFit_.residuals(nuclides, residuals.data());
+
+    /* fitted and excluded nuclides are drawn in different colours */
+    QVector<double> xFitted, yFitted, xOther, yOther;
+    for (int row = 0; row < nuclides.size(); row++) {
+        if (std::isnan(residuals[row])) continue;
+        const double residual = residuals[row] / 1.0e3;
+        if (filter.accepts(nuclides.protons()[row], nuclides.neutrons()[row], nuclides.nucleons()[row], nuclides.flags()[row])) {
+            xFitted.append(nuclides.nucleons()[row]);
+            yFitted.append(residual);
+        } else {
+            xOther.append(nuclides.nucleons()[row]);
+            yOther.append(residual);
+        }
+    }
+
+    customPlot->addGraph(customPlot->xAxis, customPlot->yAxis);
+    customPlot->graph(0)->setPen(QPen(Qt::blue));
+    customPlot->graph(0)->setData(xFitted, yFitted);
+    customPlot->graph(0)->setLineStyle(QCPGraph::lsNone);
+    customPlot->graph(0)->setScatterStyle(QCPScatterStyle(QCPScatterStyle::ssDisc, 3));
+    customPlot->graph(0)->setScatterStamping(true);
+    customPlot->graph(0)->setName(QString("Fitted (%1 nuclides, rms %2 MeV)").arg(this->semfFit_.nuclides()).arg(this->semfFit_.rms() / 1.0e3, 0, 'f', 2));
+
+    customPlot->addGraph(customPlot->xAxis, customPlot->yAxis);
+    customPlot->graph(1)->setPen(QPen(Qt::gray));
+    customPlot->graph(1)->setData(xOther, yOther);
+    customPlot->graph(1)->setLineStyle(QCPGraph::lsNone);
+    customPlot->graph(1)->setScatterStyle(QCPScatterStyle(QCPScatterStyle::ssDisc, 3));
+    customPlot->graph(1)->setScatterStamping(true);
+    customPlot->graph(1)->setName("Not Fitted");
+
+    /* show the fitted coefficients in the status bar */
+    QString coefficients;
+    for (int term = 0; term < numberOfSemfTerms; term++) {
+        const SemfTerm semfTerm = static_cast<SemfTerm>(term);
+        coefficients += QString("%1 %2 MeV  ").arg(SemfFit::termName(semfTerm)).arg(this->semfFit_.coefficient(semfTerm) / 1.0e3, 0, 'f', 3);
+    }
+    ui->statusbar->showMessage(coefficients.trimmed());
+
+    customPlot->legend->setVisible(true);
+    customPlot->setInteraction(QCP::iRangeDrag, true);
+    customPlot->setInteraction(QCP::iRangeZoom, true);
+    customPlot->axisRect()->insetLayout()->setInsetAlignment(0, Qt::AlignTop|Qt::AlignRight);
+    customPlot->yAxis2->setVisible(false);
+    customPlot->xAxis->setLabel("Nucleon Number (A)");
+    customPlot->yAxis->setLabel("Experimental - Liquid Drop Binding Energy / MeV");
+    customPlot->xAxis->setRange(0, 300);
+    customPlot->yAxis->setRange(-30, 30);
+}
+
+/* colour the chart of nuclides by the selected quantity - the grid stays, only the cells change */
+void AtomicData::plotSegreChart()
+{
+    const NuclideTable &nuclides = *this->nuclides_;
+    const ChartQuantity quantity = static_cast<ChartQuantity>(ui->comboBoxChartQuantity->currentIndex());
+    const double amutokeV = this->useAccurate_ ? AccurateConstants::amutokeV : ALevelConstants::amutokeV;
+    const ColumnSpan<std::int16_t> nucleons = nuclides.nucleons();
+    std::vector<double> values(nuclides.size());
+
+    switch (quantity) {
+    case ChartMassExcess: {
+        const ColumnSpan<double> atomicMass = nuclides.atomicMass();
+        for (int row = 0; row < nuclides.size(); row++)
+            values[row] = (atomicMass[row] - nucleons[row] * 1.0e6) * 1.0e-6 * amutokeV / 1.0e3;
+        break;
+    }
+    case ChartNeutronSeparation:
+    case ChartProtonSeparation: {
+        const SeparationChannel channel = quantity == ChartNeutronSeparation ? SeparationNeutron : SeparationProton;
+        const ColumnSpan<double> energy = this->separationEnergies_.energy(channel);
+        for (int row = 0; row < nuclides.size(); row++) values[row] = energy[row] / 1.0e3;
+        break;
+    }
+    case ChartMassUncertainty: {
+        const ColumnSpan<double> uncertainty = nuclides.atomicMassUncertainty();
+        for (int row = 0; row < nuclides.size(); row++) values[row] = uncertainty[row] * 1.0e-6 * amutokeV;
+        break;
+    }
+    case ChartSemfResidual:
+        /* use the fit from the graph tab, fitting it here if it has not been made yet */
+        if (this->semfFit_.nuclides() == 0 && !this->semfFit_.fit(nuclides, semfSubset(ui->comboBoxSemfSubset->currentIndex()))) {
+            std::fill(values.begin(), values.end(), NAN);
+            break;
+        }
+        this->semfFit_.residuals(nuclides, values.data());
+        for (double &value : values) value /= 1.0e3;
+        break;
+    default: {
+        const ColumnSpan<double> bindingEnergy = nuclides.bindingEnergy();
+        std::copy(bindingEnergy.begin(), bindingEnergy.end(), values.begin());
+        break;
+    }
+    }
+
+    this->segreChart_->setValues(values.data(), SegreChart::quantityName(quantity), quantity == ChartSemfResidual);
+    ui->customPlotChart->replot();
+}
+
+/* plot the data */
+void AtomicData::plotNuclearData(QCustomPlot *customPlot)
+{
+  // generate some data:
+  const int numberOfNuclei = this->nuclides_->size();
+  QVector<double> x(numberOfNuclei), y1(numberOfNuclei), y2(numberOfNuclei); // initialize with entries 0..numberOfNuclei
+  getMaxEnergies(x, y1, y2);
+  QVector<double> allX(numberOfNuclei), allY1(numberOfNuclei);
+  getAllEnergies(allX, allY1);
+
+  // create graph and assign data to it:
+  customPlot->setLocale(QLocale(QLocale::English, QLocale::UnitedKingdom)); // period as decimal separator and comma as thousand separator
+  customPlot->legend->setVisible(true);
+  customPlot->setInteraction(QCP::iRangeDrag, true);
+  customPlot->setInteraction(QCP::iRangeZoom, true);
+  QFont legendFont = font();  // start out with MainWindow's font..
+  legendFont.setPointSize(9); // and make a bit smaller for legend
+  customPlot->legend->setFont(legendFont);
+  customPlot->legend->setBrush(QBrush(QColor(255,255,255,230)));
+  // by default, the legend is in the inset layout of the main axis rect. So this is how we access it to change legend placement:
+  customPlot->axisRect()->insetLayout()->setInsetAlignment(0, Qt::AlignBottom|Qt::AlignRight);
+
+  // every nuclide as a scatter behind the maxima, stamped once per pixel so dragging stays smooth:
+  customPlot->addGraph(customPlot->xAxis, customPlot->yAxis);
+  customPlot->graph(0)->setPen(QPen(QColor(120, 120, 120, 150)));
+  customPlot->graph(0)->setData(allX, allY1);
+  customPlot->graph(0)->setLineStyle(QCPGraph::lsNone);
+  customPlot->graph(0)->setScatterStyle(QCPScatterStyle(QCPScatterStyle::ssDisc, 2));
+  customPlot->graph(0)->setScatterStamping(true);
+  customPlot->graph(0)->setName("All Nuclides");
+
+  customPlot->addGraph(customPlot->xAxis, customPlot->yAxis);
+  customPlot->graph(1)->setPen(QPen(Qt::blue));
+  customPlot->graph(1)->setData(x, y1);
+  customPlot->graph(1)->data()->setMinMaxPyramid(true); // zoomed out, adaptive sampling reads the value spans from the pyramid
+  customPlot->graph(1)->setLineStyle(QCPGraph::lsLine);
+  customPlot->graph(1)->setScatterStyle(QCPScatterStyle(QCPScatterStyle::ssDisc, 2));
+  customPlot->graph(1)->setName("Binding Energy per Nucleon");
+
+  customPlot->addGraph(customPlot->xAxis, customPlot->yAxis2);
+  customPlot->graph(2)->setPen(QPen(Qt::red));
+  customPlot->graph(2)->setData(x, y2);
+  customPlot->graph(2)->data()->setMinMaxPyramid(true);
+  customPlot->graph(2)->setLineStyle(QCPGraph::lsLine);
+  customPlot->graph(2)->setScatterStyle(QCPScatterStyle(QCPScatterStyle::ssDisc, 2));
+  customPlot->graph(2)->setName("Total Binding Energy");
+
+  // activate right axes, which is invisible by default:
+  customPlot->yAxis2->setVisible(true);
+  // give the axes some labels:
+  customPlot->xAxis->setLabel("Nucleon Number (A)");
+  customPlot->yAxis->setLabel("Binding Energy per Nucleon / MeV");
+  customPlot->yAxis2->setLabel("Total Binding Energy / MeV");
+  // set axes ranges, so we see all data:
+  customPlot->xAxis->setRange(0, 300);
+  customPlot->yAxis->setRange(0, 10);
+  customPlot->yAxis2->setRange(0, 2500);
+}
+
+/* find the nucleus specified by nucleon number and proton number - returns -1 if not found */
+int AtomicData::findNucleus(const int nucleonNumber, const int protonNumber){
+    return this->index_.find(protonNumber, nucleonNumber);
+}
+
+/* calculate the data for selected nucleus */
+void AtomicData::on_pushButtonCalculate_clicked()
+{
+    /* use the selected values of A and Z to find a nucleus */
+    int found = this->findNucleus(ui->spinBoxNucleonNumber->value(), ui->spinBoxProtonNumber->value());
+
+    /* set up table to view properties */
+    ui->tableWidgetOutput->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    ui->tableWidgetOutput->setColumnCount(2);
+    ui->tableWidgetOutput->setRowCount(10 + numberOfSeparationChannels);
+    ui->tableWidgetOutput->setHorizontalHeaderItem(0, new QTableWidgetItem("Property"));
+    ui->tableWidgetOutput->setColumnWidth(0, ui->tableWidgetOutput->width() * 0.6);
+    ui->tableWidgetOutput->setHorizontalHeaderItem(1, new QTableWidgetItem("Value"));
+    ui->tableWidgetOutput->setItem(0, 0, new QTableWidgetItem("Element"));
+
+    /* display data if found */
+    if (found >= 0){
+        Atom atom = this->nuclides_->atom(found);
+        if (this->useAccurate_) this->showNucleus<AccurateConstants>(atom);
+        else this->showNucleus<ALevelConstants>(atom);
+
+        /* separation energies in keV depend on the constants - they are recomputed whenever the set changes */
+        for (int channel = 0; channel < numberOfSeparationChannels; channel++) {
+            const SeparationChannel separation = static_cast<SeparationChannel>(channel);
+            const double energy = this->separationEnergies_.energy(separation)[found];
+            const double uncertainty = this->separationEnergies_.uncertainty(separation)[found];
+            ui->tableWidgetOutput->setItem(10 + channel, 0, new QTableWidgetItem(QString("%1 / MeV").arg(SeparationEnergies::channelName(separation))));
+            if (std::isnan(energy)) {
+                ui->tableWidgetOutput->setItem(10 + channel, 1, new QTableWidgetItem("Not Available"));
+            } else {
+                ui->tableWidgetOutput->setItem(10 + channel, 1, new QTableWidgetItem(QString::number(energy/1.0e3, 'g', 8) + " " + QChar(0x00b1) + " " + QString::number(uncertainty/1.0e3, 'g', 3)));
+            }
+        }
+    } else {
+        ui->tableWidgetOutput->setItem(0, 1, new QTableWidgetItem("Not Found"));
+    }
+}
+
+/* fill the calculator output using a set of constants */
+template <typename Constants>
+void AtomicData::showNucleus(Atom &atom)
+{
+    ui->tableWidgetOutput->setItem(0, 1, new QTableWidgetItem(QString::fromStdString(atom.getElement())));
+    ui->tableWidgetOutput->setItem(1, 0, new QTableWidgetItem("Protons"));
+    ui->tableWidgetOutput->setItem(1, 1, new QTableWidgetItem(QString::number(atom.getProtons())));
+    ui->tableWidgetOutput->setItem(2, 0, new QTableWidgetItem("Neutrons"));
+    ui->tableWidgetOutput->setItem(2, 1, new QTableWidgetItem(QString::number(atom.getNeutrons())));
+    ui->tableWidgetOutput->setItem(3, 0, new QTableWidgetItem("Atomic Mass / amu"));
+    ui->tableWidgetOutput->setItem(3, 1, new QTableWidgetItem(QString::number(atom.getAtomicMass(), 'g', 8)));
+    ui->tableWidgetOutput->setItem(4, 0, new QTableWidgetItem("Nuclear Mass / amu"));
+    const ElectronBindingModel electronBinding = static_cast<ElectronBindingModel>(ui->comboBoxElectronBinding->currentIndex());
+    ui->tableWidgetOutput->setItem(4, 1, new QTableWidgetItem(QString::number(atom.calcNuclearMass<Constants>(electronBinding), 'g', 8)));
+    ui->tableWidgetOutput->setItem(5, 0, new QTableWidgetItem("Nuclear Mass Defect / amu"));
+    ui->tableWidgetOutput->setItem(5, 1, new QTableWidgetItem(QString::number(atom.calcMassDefectamu<Constants>(), 'g', 8)));
+    ui->tableWidgetOutput->setItem(6, 0, new QTableWidgetItem("Nuclear Mass Defect / kg"));
+    ui->tableWidgetOutput->setItem(6, 1, new QTableWidgetItem(QString::number(atom.calcMassDefectkg<Constants>(), 'g', 8)));
+    ui->tableWidgetOutput->setItem(7, 0, new QTableWidgetItem("Nuclear Binding Energy / J"));
+    ui->tableWidgetOutput->setItem(7, 1, new QTableWidgetItem(QString::number(atom.calcBindingEnergyJ<Constants>(), 'g', 8)));
+    ui->tableWidgetOutput->setItem(8, 0, new QTableWidgetItem("Nuclear Binding Energy / MeV"));
+    ui->tableWidgetOutput->setItem(8, 1, new QTableWidgetItem(QString::number(atom.calcBindingEnergykeV<Constants>()/1.0e3, 'g', 8)));
+    ui->tableWidgetOutput->setItem(9, 0, new QTableWidgetItem("Binding Energy per Nucleon/ MeV"));
+    ui->tableWidgetOutput->setItem(9, 1, new QTableWidgetItem(QString::number(atom.calcBindingEnergyperNucleonkeV<Constants>()/1.0e3, 'g', 8)));
+}
+
+void AtomicData::getMaxEnergies(QVector<double> &x, QVector<double> &y1, QVector<double> &y2){
+    /* only the nucleon and binding energy columns are needed */
+    const ColumnSpan<std::int16_t> nucleons = this->nuclides_->nucleons();
+    const ColumnSpan<double> bindingEnergy = this->nuclides_->bindingEnergy();
+    const int numberOfNuclei = nucleons.size();
+
+    int maxNucleonNumber = nucleons[numberOfNuclei - 1];
+    int counter = 0;
+    for (int i = 0; i < maxNucleonNumber ; i++) {
+        int nucleonNumber = i + 1;
+        double maxEnergy = 0;
+        while (counter < numberOfNuclei && nucleons[counter] == nucleonNumber){
+            double newEnergy = bindingEnergy[counter];
+            if (newEnergy > maxEnergy){
+                maxEnergy = newEnergy;
+            }
+            counter++;
+        }
+        x[i] = nucleonNumber;
+        y1[i] = maxEnergy / 1.0e3;
+        y2[i] = maxEnergy * nucleonNumber / 1.0e3;
+    }
+}
+
+/* the total binding energies are only filled if y2 is given */
+void AtomicData::getAllEnergies(QVector<double> &x, QVector<double> &y1, QVector<double> *y2){
+    const ColumnSpan<std::int16_t> nucleons = this->nuclides_->nucleons();
+    const ColumnSpan<double> bindingEnergy = this->nuclides_->bindingEnergy();
+    for (int i = 0; i < nucleons.size(); ++i){
+      x[i] = nucleons[i];                         // Nucleon Number
+      y1[i] = bindingEnergy[i]/1e3;               // Binding Energy / Nucleon
+      if (y2) (*y2)[i] = y1[i] * x[i];            // Total Binding Energy
+    }
+}
+
+void AtomicData::on_checkBox_stateChanged(int /* arg1 */)
+{
+    /* set up labels */
+    this->useAccurate_ = ui->checkBox->isChecked();
+    this->showConstants();
+
+    /* masses and separation energies in keV depend on the constants */
+    if (this->nuclides_->empty()) return;
+    this->computeSeparationEnergies();
+    const int quantity = ui->comboBoxChartQuantity->currentIndex();
+    if (quantity == ChartMassExcess || quantity == ChartMassUncertainty || quantity == ChartNeutronSeparation || quantity == ChartProtonSeparation) plotSegreChart();
+}
+
+/* separation energies of every nuclide with the selected constants */
+void AtomicData::computeSeparationEnergies()
+{
+    if (this->useAccurate_) this->separationEnergies_.compute<AccurateConstants>(*this->nuclides_, this->index_);
+    else this->separationEnergies_.compute<ALevelConstants>(*this->nuclides_, this->index_);
+}
+
+/* show the constants of the selected set */
+void AtomicData::showConstants()
+{
+    if (this->useAccurate_) this->showConstantLabels<AccurateConstants>();
+    else this->showConstantLabels<ALevelConstants>();
+}
+
+template <typename Constants>
+void AtomicData::showConstantLabels()
+{
+    ui->label_electronCharge->setText("e = " + QString::number(Atom::getElectronCharge<Constants>(), 'g', 12) + " C");
+    ui->label_speedofLight->setText("c = " + QString::number(Atom::getSpeedofLight<Constants>(), 'g', 12) + " m/s");
+    ui->label_amu->setText("u = " + QString::number(Atom::getAtomicMassUnit<Constants>(), 'g', 12) + " kg");
+    ui->label_electronMass->setText("me = " + QString::number(Atom::getElectronMass<Constants>(), 'g', 12) + " u");
+    ui->label_protonMass->setText("mp = " + QString::number(Atom::getProtonMass<Constants>(), 'g', 12) + " u");
+    ui->label_neutronMass->setText("mn = " + QString::number(Atom::getNeutronMass<Constants>(), 'g', 12) + " u");
+}
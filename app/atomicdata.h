@@ -0,0 +1,79 @@
+#ifndef ATOMICDATA_H
+#define ATOMICDATA_H
+
+#include <QMainWindow>
+#include <QThread>
+#include "atom.h"
+#include "ameparser.h"
+#include "nuclideloader.h"
+#include "nuclidetable.h"
+#include "nuclideindex.h"
+#include "nuclidetablemodel.h"
+#include "segrechart.h"
+#include "semf.h"
+#include "separationenergies.h"
+#include "qcustomplot.h"
+#include <memory>
+
+QT_BEGIN_NAMESPACE
+namespace Ui { class AtomicData; }
+QT_END_NAMESPACE
+
+class AtomicData : public QMainWindow
+{
+    Q_OBJECT
+
+public:
+    AtomicData(QWidget *parent = nullptr);
+    ~AtomicData();
+
+private slots:
+    int findNucleus(const int nucleonNumber, const int protonNumber);
+    void onLoadProgress(int nuclides);
+    void onNuclidesLoaded(int nuclides);
+    void onLoadFailed(const QString &message);
+    void on_pushButtonCalculate_clicked();
+
+    void on_checkBox_stateChanged(int arg1);
+
+    void on_comboBoxGraph_currentIndexChanged(int index);
+
+    void on_comboBoxSemfSubset_currentIndexChanged(int index);
+
+    void on_comboBoxChartQuantity_currentIndexChanged(int index);
+
+    void on_pushButtonFilterReset_clicked();
+
+    void applyDataFilter();
+
+private:
+    Ui::AtomicData *ui;
+
+    /* variable to store atom data */
+    std::unique_ptr<NuclideTable> nuclides_;
+    NuclideIndex index_;
+    SeparationEnergies separationEnergies_;
+    SemfFit semfFit_;
+    std::unique_ptr<SegreChart> segreChart_;
+    NuclideTableModel nuclideModel_;
+
+    /* true to calculate with the accurate constants, false for the a-level constants */
+    bool useAccurate_;
+
+    /* loader running on its own thread */
+    QThread loaderThread_;
+    NuclideLoader *loader_;
+
+    /* private functions */
+    void plotGraph();
+    void plotNuclearData(QCustomPlot *customPlot);
+    void plotSemfResiduals(QCustomPlot *customPlot);
+    void plotSegreChart();
+    void computeSeparationEnergies();
+    void getMaxEnergies(QVector<double> &x, QVector<double> &y1, QVector<double> &y2);
+    void getAllEnergies(QVector<double> &x, QVector<double> &y1, QVector<double> *y2 = nullptr);
+    void showConstants();
+    template <typename Constants> void showConstantLabels();
+    template <typename Constants> void showNucleus(Atom &atom);
+};
+#endif // ATOMICDATA_H
@@ -0,0 +1,396 @@
+#include "colorizekernel.h"
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+/* the vector kernels are built with per function target attributes and picked at runtime */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define COLORIZE_X86
+#include <immintrin.h>
+#endif
+
+enum ColorizeInstructionSet
+{
+    ColorizeScalar,
+    ColorizeSse2,
+    ColorizeAvx2
+};
+
+/* ask the cpu once which kernels it can run */
+static ColorizeInstructionSet instructionSet()
+{
+    static const ColorizeInstructionSet instructionSet = []() {
+#ifdef COLORIZE_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return ColorizeAvx2;
+        if (__builtin_cpu_supports("sse2")) return ColorizeSse2;
+#endif
+        return ColorizeScalar;
+    }();
+    return instructionSet;
+}
+
+const char *colorizeInstructionSet()
+{
+    switch (instructionSet()) {
+    case ColorizeAvx2: return "AVX2";
+    case ColorizeSse2: return "SSE2";
+    default: return "scalar";
+    }
+}
+
+/* scalar loops - these are the loops of QCPColorGradient::colorize and the reference for the vector kernels */
+static inline int clampIndex(int index, int levelCount)
+{
+    if (index < 0) return 0;
+    if (index >= levelCount) return levelCount - 1;
+    return index;
+}
+
+static void colorizeLinearScalar(const double *data, int dataIndexFactor, int n, double lower, double posToIndexFactor,
+                                 const std::uint32_t *colors, int levelCount, std::uint32_t *scanLine)
+{
+    for (int i = 0; i < n; ++i) {
+        const int index = (data[dataIndexFactor * i] - lower) * posToIndexFactor;
+        scanLine[i] = colors[clampIndex(index, levelCount)];
+    }
+}
+
+static void colorizeLogarithmicScalar(const double *data, int dataIndexFactor, int n, double lower, double logRange,
+                                      const std::uint32_t *colors, int levelCount, std::uint32_t *scanLine)
+{
+    for (int i = 0; i < n; ++i) {
+        const int index = std::log(data[dataIndexFactor * i] / lower) / logRange * (levelCount - 1);
+        scanLine[i] = colors[clampIndex(index, levelCount)];
+    }
+}
+
+static inline std::uint32_t premultiply(std::uint32_t rgb, unsigned char alpha)
+{
+    const float alphaF = alpha / 255.0f;
+    const std::uint32_t a = static_cast<int>(((rgb >> 24) & 0xff) * alphaF);
+    const std::uint32_t r = static_cast<int>(((rgb >> 16) & 0xff) * alphaF);
+    const std::uint32_t g = static_cast<int>(((rgb >> 8) & 0xff) * alphaF);
+    const std::uint32_t b = static_cast<int>((rgb & 0xff) * alphaF);
+    return ((a & 0xff) << 24) | ((r & 0xff) << 16) | ((g & 0xff) << 8) | (b & 0xff);
+}
+
+static void colorizeApplyAlphaScalar(const unsigned char *alpha, int dataIndexFactor, int n, std::uint32_t *scanLine)
+{
+    for (int i = 0; i < n; ++i) {
+        const unsigned char a = alpha[dataIndexFactor * i];
+        if (a != 255) scanLine[i] = premultiply(scanLine[i], a);
+    }
+}
+
+#ifdef COLORIZE_X86
+
+/* log(2) split so e * log2Hi is exact for any double exponent */
+static constexpr double log2Hi_ = 6.93147180369123816490e-01;
+static constexpr double log2Lo_ = 1.90821492927058770002e-10;
+
+/* ---------------------------------------------------------------- SSE2 - two doubles per vector */
+
+__attribute__((target("sse2")))
+static inline __m128d loadSse2(const double *data, int dataIndexFactor, int i)
+{
+    if (dataIndexFactor == 1) return _mm_loadu_pd(data + i);
+    return _mm_set_pd(data[dataIndexFactor * (i + 1)], data[dataIndexFactor * i]);
+}
+
+/* truncate four positions to indices the way a scalar int conversion does, then clamp them to the table */
+__attribute__((target("sse2")))
+static inline __m128i indicesSse2(__m128d low, __m128d high, __m128i maxIndex)
+{
+    __m128i index = _mm_unpacklo_epi64(_mm_cvttpd_epi32(low), _mm_cvttpd_epi32(high));
+    index = _mm_andnot_si128(_mm_cmplt_epi32(index, _mm_setzero_si128()), index);
+    const __m128i above = _mm_cmpgt_epi32(index, maxIndex);
+    return _mm_or_si128(_mm_and_si128(above, maxIndex), _mm_andnot_si128(above, index));
+}
+
+__attribute__((target("sse2")))
+static inline void lookupSse2(__m128i index, const std::uint32_t *colors, std::uint32_t *scanLine)
+{
+    alignas(16) int indices[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(indices), index);
+    scanLine[0] = colors[indices[0]];
+    scanLine[1] = colors[indices[1]];
+    scanLine[2] = colors[indices[2]];
+    scanLine[3] = colors[indices[3]];
+}
+
+/* natural log of positive, finite, normal doubles - x = m 2^e with m in [sqrt(1/2), sqrt(2)) and log(m) = 2 atanh((m - 1) / (m + 1)) */
+__attribute__((target("sse2")))
+static inline __m128d logSse2(__m128d x)
+{
+    const __m128i bits = _mm_castpd_si128(x);
+    const __m128i exponentBits = _mm_shuffle_epi32(_mm_srli_epi64(bits, 52), _MM_SHUFFLE(3, 1, 2, 0));
+    __m128d e = _mm_sub_pd(_mm_cvtepi32_pd(exponentBits), _mm_set1_pd(1023.0));
+    __m128d m = _mm_castsi128_pd(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi64x(0x000fffffffffffffLL)),
+                                              _mm_set1_epi64x(0x3ff0000000000000LL)));
+    const __m128d large = _mm_cmpge_pd(m, _mm_set1_pd(1.41421356237309504880));
+    m = _mm_or_pd(_mm_and_pd(large, _mm_mul_pd(m, _mm_set1_pd(0.5))), _mm_andnot_pd(large, m));
+    e = _mm_add_pd(e, _mm_and_pd(large, _mm_set1_pd(1.0)));
+
+    const __m128d one = _mm_set1_pd(1.0);
+    const __m128d s = _mm_div_pd(_mm_sub_pd(m, one), _mm_add_pd(m, one));
+    const __m128d z = _mm_mul_pd(s, s);
+    __m128d series = _mm_set1_pd(1.0 / 19.0);
+    series = _mm_add_pd(_mm_mul_pd(series, z), _mm_set1_pd(1.0 / 17.0));
+    series = _mm_add_pd(_mm_mul_pd(series, z), _mm_set1_pd(1.0 / 15.0));
+    series = _mm_add_pd(_mm_mul_pd(series, z), _mm_set1_pd(1.0 / 13.0));
+    series = _mm_add_pd(_mm_mul_pd(series, z), _mm_set1_pd(1.0 / 11.0));
+    series = _mm_add_pd(_mm_mul_pd(series, z), _mm_set1_pd(1.0 / 9.0));
+    series = _mm_add_pd(_mm_mul_pd(series, z), _mm_set1_pd(1.0 / 7.0));
+    series = _mm_add_pd(_mm_mul_pd(series, z), _mm_set1_pd(1.0 / 5.0));
+    series = _mm_add_pd(_mm_mul_pd(series, z), _mm_set1_pd(1.0 / 3.0));
+    const __m128d twoS = _mm_add_pd(s, s);
+    const __m128d logM = _mm_add_pd(twoS, _mm_mul_pd(_mm_mul_pd(twoS, z), series));
+    return _mm_add_pd(_mm_mul_pd(e, _mm_set1_pd(log2Hi_)), _mm_add_pd(_mm_mul_pd(e, _mm_set1_pd(log2Lo_)), logM));
+}
+
+/* true if both lanes are positive, finite and normal */
+__attribute__((target("sse2")))
+static inline bool logDomainSse2(__m128d x)
+{
+    const __m128d inside = _mm_and_pd(_mm_cmpge_pd(x, _mm_set1_pd(DBL_MIN)), _mm_cmple_pd(x, _mm_set1_pd(DBL_MAX)));
+    return _mm_movemask_pd(inside) == 0x3;
+}
+
+__attribute__((target("sse2")))
+static void colorizeLinearSse2(const double *data, int dataIndexFactor, int n, double lower, double posToIndexFactor,
+                               const std::uint32_t *colors, int levelCount, std::uint32_t *scanLine)
+{
+    const __m128d lowerV = _mm_set1_pd(lower);
+    const __m128d factorV = _mm_set1_pd(posToIndexFactor);
+    const __m128i maxIndex = _mm_set1_epi32(levelCount - 1);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m128d low = _mm_mul_pd(_mm_sub_pd(loadSse2(data, dataIndexFactor, i), lowerV), factorV);
+        const __m128d high = _mm_mul_pd(_mm_sub_pd(loadSse2(data, dataIndexFactor, i + 2), lowerV), factorV);
+        lookupSse2(indicesSse2(low, high, maxIndex), colors, scanLine + i);
+    }
+    colorizeLinearScalar(data + dataIndexFactor * i, dataIndexFactor, n - i, lower, posToIndexFactor, colors, levelCount, scanLine + i);
+}
+
+__attribute__((target("sse2")))
+static void colorizeLogarithmicSse2(const double *data, int dataIndexFactor, int n, double lower, double logRange,
+                                    const std::uint32_t *colors, int levelCount, std::uint32_t *scanLine)
+{
+    const __m128d lowerV = _mm_set1_pd(lower);
+    const __m128d positionFactor = _mm_set1_pd((levelCount - 1) / logRange);
+    const __m128i maxIndex = _mm_set1_epi32(levelCount - 1);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m128d low = _mm_div_pd(loadSse2(data, dataIndexFactor, i), lowerV);
+        const __m128d high = _mm_div_pd(loadSse2(data, dataIndexFactor, i + 2), lowerV);
+        if (!logDomainSse2(low) || !logDomainSse2(high)) {
+            colorizeLogarithmicScalar(data + dataIndexFactor * i, dataIndexFactor, 4, lower, logRange, colors, levelCount, scanLine + i);
+            continue;
+        }
+        const __m128d lowPosition = _mm_mul_pd(logSse2(low), positionFactor);
+        const __m128d highPosition = _mm_mul_pd(logSse2(high), positionFactor);
+        lookupSse2(indicesSse2(lowPosition, highPosition, maxIndex), colors, scanLine + i);
+    }
+    colorizeLogarithmicScalar(data + dataIndexFactor * i, dataIndexFactor, n - i, lower, logRange, colors, levelCount, scanLine + i);
+}
+
+/* premultiply four pixels - alpha 255 multiplies by exactly 1 and alpha 0 gives 0, as in the scalar loop */
+__attribute__((target("sse2")))
+static void colorizeApplyAlphaSse2(const unsigned char *alpha, int dataIndexFactor, int n, std::uint32_t *scanLine)
+{
+    const __m128i opaque = _mm_set1_epi32(255);
+    const __m128i channelMask = _mm_set1_epi32(0xff);
+    const __m128 scale = _mm_set1_ps(255.0f);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i a;
+        if (dataIndexFactor == 1) {
+            std::uint32_t packed;
+            std::memcpy(&packed, alpha + i, sizeof(packed));
+            if (packed == 0xffffffffu) continue;
+            a = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(static_cast<int>(packed)), _mm_setzero_si128()), _mm_setzero_si128());
+        } else {
+            a = _mm_set_epi32(alpha[dataIndexFactor * (i + 3)], alpha[dataIndexFactor * (i + 2)],
+                              alpha[dataIndexFactor * (i + 1)], alpha[dataIndexFactor * i]);
+        }
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(a, opaque)) == 0xffff) continue;
+        const __m128 alphaF = _mm_div_ps(_mm_cvtepi32_ps(a), scale);
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(scanLine + i));
+        __m128i result = _mm_setzero_si128();
+        for (int shift = 0; shift < 32; shift += 8) {
+            const __m128i channel = _mm_and_si128(_mm_srli_epi32(pixels, shift), channelMask);
+            const __m128i scaled = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(channel), alphaF));
+            result = _mm_or_si128(result, _mm_slli_epi32(_mm_and_si128(scaled, channelMask), shift));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(scanLine + i), result);
+    }
+    colorizeApplyAlphaScalar(alpha + dataIndexFactor * i, dataIndexFactor, n - i, scanLine + i);
+}
+
+/* ---------------------------------------------------------------- AVX2 - four doubles per vector, colours gathered */
+
+__attribute__((target("avx2")))
+static inline __m256d loadAvx2(const double *data, int dataIndexFactor, int i)
+{
+    if (dataIndexFactor == 1) return _mm256_loadu_pd(data + i);
+    return _mm256_set_pd(data[dataIndexFactor * (i + 3)], data[dataIndexFactor * (i + 2)],
+                         data[dataIndexFactor * (i + 1)], data[dataIndexFactor * i]);
+}
+
+/* truncate eight positions to clamped indices and gather their colours */
+__attribute__((target("avx2")))
+static inline void lookupAvx2(__m256d low, __m256d high, __m256i maxIndex, const std::uint32_t *colors, std::uint32_t *scanLine)
+{
+    __m256i index = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm256_cvttpd_epi32(low)), _mm256_cvttpd_epi32(high), 1);
+    index = _mm256_min_epi32(_mm256_max_epi32(index, _mm256_setzero_si256()), maxIndex);
+    const __m256i colours = _mm256_i32gather_epi32(reinterpret_cast<const int *>(colors), index, 4);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(scanLine), colours);
+}
+
+__attribute__((target("avx2")))
+static inline __m256d logAvx2(__m256d x)
+{
+    const __m256i bits = _mm256_castpd_si256(x);
+    const __m256i exponentBits = _mm256_permutevar8x32_epi32(_mm256_srli_epi64(bits, 52), _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6));
+    __m256d e = _mm256_sub_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(exponentBits)), _mm256_set1_pd(1023.0));
+    __m256d m = _mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi64x(0x000fffffffffffffLL)),
+                                                    _mm256_set1_epi64x(0x3ff0000000000000LL)));
+    const __m256d large = _mm256_cmp_pd(m, _mm256_set1_pd(1.41421356237309504880), _CMP_GE_OQ);
+    m = _mm256_blendv_pd(m, _mm256_mul_pd(m, _mm256_set1_pd(0.5)), large);
+    e = _mm256_add_pd(e, _mm256_and_pd(large, _mm256_set1_pd(1.0)));
+
+    /* plain multiplies and adds, no fma, so the result matches the SSE2 kernel */
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d s = _mm256_div_pd(_mm256_sub_pd(m, one), _mm256_add_pd(m, one));
+    const __m256d z = _mm256_mul_pd(s, s);
+    __m256d series = _mm256_set1_pd(1.0 / 19.0);
+    series = _mm256_add_pd(_mm256_mul_pd(series, z), _mm256_set1_pd(1.0 / 17.0));
+    series = _mm256_add_pd(_mm256_mul_pd(series, z), _mm256_set1_pd(1.0 / 15.0));
+    series = _mm256_add_pd(_mm256_mul_pd(series, z), _mm256_set1_pd(1.0 / 13.0));
+    series = _mm256_add_pd(_mm256_mul_pd(series, z), _mm256_set1_pd(1.0 / 11.0));
+    series = _mm256_add_pd(_mm256_mul_pd(series, z), _mm256_set1_pd(1.0 / 9.0));
+    series = _mm256_add_pd(_mm256_mul_pd(series, z), _mm256_set1_pd(1.0 / 7.0));
+    series = _mm256_add_pd(_mm256_mul_pd(series, z), _mm256_set1_pd(1.0 / 5.0));
+    series = _mm256_add_pd(_mm256_mul_pd(series, z), _mm256_set1_pd(1.0 / 3.0));
+    const __m256d twoS = _mm256_add_pd(s, s);
+    const __m256d logM = _mm256_add_pd(twoS, _mm256_mul_pd(_mm256_mul_pd(twoS, z), series));
+    return _mm256_add_pd(_mm256_mul_pd(e, _mm256_set1_pd(log2Hi_)), _mm256_add_pd(_mm256_mul_pd(e, _mm256_set1_pd(log2Lo_)), logM));
+}
+
+__attribute__((target("avx2")))
+static inline bool logDomainAvx2(__m256d x)
+{
+    const __m256d inside = _mm256_and_pd(_mm256_cmp_pd(x, _mm256_set1_pd(DBL_MIN), _CMP_GE_OQ),
+                                         _mm256_cmp_pd(x, _mm256_set1_pd(DBL_MAX), _CMP_LE_OQ));
+    return _mm256_movemask_pd(inside) == 0xf;
+}
+
+__attribute__((target("avx2")))
+static void colorizeLinearAvx2(const double *data, int dataIndexFactor, int n, double lower, double posToIndexFactor,
+                               const std::uint32_t *colors, int levelCount, std::uint32_t *scanLine)
+{
+    const __m256d lowerV = _mm256_set1_pd(lower);
+    const __m256d factorV = _mm256_set1_pd(posToIndexFactor);
+    const __m256i maxIndex = _mm256_set1_epi32(levelCount - 1);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256d low = _mm256_mul_pd(_mm256_sub_pd(loadAvx2(data, dataIndexFactor, i), lowerV), factorV);
+        const __m256d high = _mm256_mul_pd(_mm256_sub_pd(loadAvx2(data, dataIndexFactor, i + 4), lowerV), factorV);
+        lookupAvx2(low, high, maxIndex, colors, scanLine + i);
+    }
+    colorizeLinearScalar(data + dataIndexFactor * i, dataIndexFactor, n - i, lower, posToIndexFactor, colors, levelCount, scanLine + i);
+}
+
+__attribute__((target("avx2")))
+static void colorizeLogarithmicAvx2(const double *data, int dataIndexFactor, int n, double lower, double logRange,
+                                    const std::uint32_t *colors, int levelCount, std::uint32_t *scanLine)
+{
+    const __m256d lowerV = _mm256_set1_pd(lower);
+    const __m256d positionFactor = _mm256_set1_pd((levelCount - 1) / logRange);
+    const __m256i maxIndex = _mm256_set1_epi32(levelCount - 1);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256d low = _mm256_div_pd(loadAvx2(data, dataIndexFactor, i), lowerV);
+        const __m256d high = _mm256_div_pd(loadAvx2(data, dataIndexFactor, i + 4), lowerV);
+        if (!logDomainAvx2(low) || !logDomainAvx2(high)) {
+            colorizeLogarithmicScalar(data + dataIndexFactor * i, dataIndexFactor, 8, lower, logRange, colors, levelCount, scanLine + i);
+            continue;
+        }
+        const __m256d lowPosition = _mm256_mul_pd(logAvx2(low), positionFactor);
+        const __m256d highPosition = _mm256_mul_pd(logAvx2(high), positionFactor);
+        lookupAvx2(lowPosition, highPosition, maxIndex, colors, scanLine + i);
+    }
+    colorizeLogarithmicScalar(data + dataIndexFactor * i, dataIndexFactor, n - i, lower, logRange, colors, levelCount, scanLine + i);
+}
+
+__attribute__((target("avx2")))
+static void colorizeApplyAlphaAvx2(const unsigned char *alpha, int dataIndexFactor, int n, std::uint32_t *scanLine)
+{
+    const __m256i opaque = _mm256_set1_epi32(255);
+    const __m256i channelMask = _mm256_set1_epi32(0xff);
+    const __m256 scale = _mm256_set1_ps(255.0f);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i a;
+        if (dataIndexFactor == 1) {
+            a = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(alpha + i)));
+        } else {
+            a = _mm256_setr_epi32(alpha[dataIndexFactor * i], alpha[dataIndexFactor * (i + 1)],
+                                  alpha[dataIndexFactor * (i + 2)], alpha[dataIndexFactor * (i + 3)],
+                                  alpha[dataIndexFactor * (i + 4)], alpha[dataIndexFactor * (i + 5)],
+                                  alpha[dataIndexFactor * (i + 6)], alpha[dataIndexFactor * (i + 7)]);
+        }
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(a, opaque)) == -1) continue;
+        const __m256 alphaF = _mm256_div_ps(_mm256_cvtepi32_ps(a), scale);
+        const __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(scanLine + i));
+        __m256i result = _mm256_setzero_si256();
+        for (int shift = 0; shift < 32; shift += 8) {
+            const __m256i channel = _mm256_and_si256(_mm256_srli_epi32(pixels, shift), channelMask);
+            const __m256i scaled = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(channel), alphaF));
+            result = _mm256_or_si256(result, _mm256_slli_epi32(_mm256_and_si256(scaled, channelMask), shift));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(scanLine + i), result);
+    }
+    colorizeApplyAlphaScalar(alpha + dataIndexFactor * i, dataIndexFactor, n - i, scanLine + i);
+}
+
+#endif // COLORIZE_X86
+
+void colorizeLinear(const double *data, int dataIndexFactor, int n, double lower, double posToIndexFactor,
+                    const std::uint32_t *colors, int levelCount, std::uint32_t *scanLine)
+{
+#ifdef COLORIZE_X86
+    switch (instructionSet()) {
+    case ColorizeAvx2: colorizeLinearAvx2(data, dataIndexFactor, n, lower, posToIndexFactor, colors, levelCount, scanLine); return;
+    case ColorizeSse2: colorizeLinearSse2(data, dataIndexFactor, n, lower, posToIndexFactor, colors, levelCount, scanLine); return;
+    default: break;
+    }
+#endif
+    colorizeLinearScalar(data, dataIndexFactor, n, lower, posToIndexFactor, colors, levelCount, scanLine);
+}
+
+void colorizeLogarithmic(const double *data, int dataIndexFactor, int n, double lower, double logRange,
+                         const std::uint32_t *colors, int levelCount, std::uint32_t *scanLine)
+{
+#ifdef COLORIZE_X86
+    switch (instructionSet()) {
+    case ColorizeAvx2: colorizeLogarithmicAvx2(data, dataIndexFactor, n, lower, logRange, colors, levelCount, scanLine); return;
+    case ColorizeSse2: colorizeLogarithmicSse2(data, dataIndexFactor, n, lower, logRange, colors, levelCount, scanLine); return;
+    default: break;
+    }
+#endif
+    colorizeLogarithmicScalar(data, dataIndexFactor, n, lower, logRange, colors, levelCount, scanLine);
+}
+
+void colorizeApplyAlpha(const unsigned char *alpha, int dataIndexFactor, int n, std::uint32_t *scanLine)
+{
+#ifdef COLORIZE_X86
+    switch (instructionSet()) {
+    case ColorizeAvx2: colorizeApplyAlphaAvx2(alpha, dataIndexFactor, n, scanLine); return;
+    case ColorizeSse2: colorizeApplyAlphaSse2(alpha, dataIndexFactor, n, scanLine); return;
+    default: break;
+    }
+#endif
+    colorizeApplyAlphaScalar(alpha, dataIndexFactor, n, scanLine);
+}
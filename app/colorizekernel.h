@@ -0,0 +1,33 @@
+#ifndef COLORIZEKERNEL_H
+#define COLORIZEKERNEL_H
+
+#include <cstdint>
+
+/*
+ * Vectorised kernels behind QCPColorGradient::colorize for non periodic gradients. Each kernel maps
+ * n data values, read every dataIndexFactor elements, to colour table indices and writes the
+ * premultiplied colours to scanLine. An AVX2 kernel (with gathers from the colour table) or an SSE2
+ * kernel is chosen once at runtime from the cpu, with a scalar kernel for other cpus and compilers.
+ *
+ * The linear kernel truncates and clamps exactly as the scalar loop does, so the colours are
+ * identical. The logarithmic kernel evaluates the log with a series accurate to a few ulp and scales
+ * it by one precomputed factor, so a value within rounding of a level boundary may land one level
+ * away from the scalar loop. Values which are not positive, finite and normal go through the
+ * scalar loop.
+ */
+
+/* index = (data - lower) * posToIndexFactor, clamped to the table */
+void colorizeLinear(const double *data, int dataIndexFactor, int n, double lower, double posToIndexFactor,
+                    const std::uint32_t *colors, int levelCount, std::uint32_t *scanLine);
+
+/* index = log(data / lower) / logRange * (levelCount - 1), clamped to the table - logRange is log(upper / lower) */
+void colorizeLogarithmic(const double *data, int dataIndexFactor, int n, double lower, double logRange,
+                         const std::uint32_t *colors, int levelCount, std::uint32_t *scanLine);
+
+/* premultiply colours already in scanLine by a per cell alpha, as the alpha overload of colorize does */
+void colorizeApplyAlpha(const unsigned char *alpha, int dataIndexFactor, int n, std::uint32_t *scanLine);
+
+/* returns the instruction set the kernels run with - "AVX2", "SSE2" or "scalar" */
+const char *colorizeInstructionSet();
+
+#endif // COLORIZEKERNEL_H
@@ -0,0 +1,117 @@
+#include "nuclidetablemodel.h"
+#include <vector>
+
+/* constructor */
+NuclideTableModel::NuclideTableModel(QObject *parent)
+    : QAbstractTableModel(parent)
+    , table_(nullptr)
+{
+}
+
+/* swap the table shown by the model - every sort order is worked out here, once per table */
+void NuclideTableModel::setTable(const NuclideTable *table)
+{
+    beginResetModel();
+    const NuclideColumn column = this->selection_.sortColumn();
+    const bool descending = this->selection_.descending();
+    this->table_ = table;
+    if (table != nullptr) {
+        this->selection_.build(*table);
+        this->selection_.filter(*table, this->filter_);
+        this->selection_.sort(column, descending);
+    } else {
+        this->selection_.clear();
+    }
+    endResetModel();
+}
+
+/* change the filter - the rows keep the current sort order */
+void NuclideTableModel::setFilter(const NuclideFilter &filter)
+{
+    beginResetModel();
+    this->filter_ = filter;
+    if (this->table_ != nullptr) this->selection_.filter(*this->table_, filter);
+    endResetModel();
+}
+
+/* sort by a column by switching to its precomputed permutation */
+void NuclideTableModel::sort(int column, Qt::SortOrder order)
+{
+    if (column < 0 || column >= numberOfNuclideColumns) return;
+    emit layoutAboutToBeChanged(QList<QPersistentModelIndex>(), QAbstractItemModel::VerticalSortHint);
+
+    /* remember which nuclides the persistent indexes (current cell, selection) point at */
+    const QModelIndexList persistent = persistentIndexList();
+    std::vector<int> tableRows;
+    tableRows.reserve(persistent.size());
+    for (const QModelIndex &index : persistent) tableRows.push_back(this->selection_.row(index.row()));
+
+    this->selection_.sort(static_cast<NuclideColumn>(column), order == Qt::DescendingOrder);
+
+    /* and move them to where those nuclides are now */
+    if (!persistent.isEmpty()) {
+        std::vector<int> positions(this->table_ != nullptr ? this->table_->size() : 0, -1);
+        for (int position = 0; position < this->selection_.size(); position++) positions[this->selection_.row(position)] = position;
+        QModelIndexList moved;
+        moved.reserve(persistent.size());
+        for (int i = 0; i < persistent.size(); i++) moved.append(this->index(positions[tableRows[i]], persistent[i].column()));
+        changePersistentIndexList(persistent, moved);
+    }
+    emit layoutChanged(QList<QPersistentModelIndex>(), QAbstractItemModel::VerticalSortHint);
+}
+
+int NuclideTableModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid() || this->table_ == nullptr) return 0;
+    return this->selection_.size();
+}
+
+int NuclideTableModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : numberOfNuclideColumns;
+}
+
+/* format a single cell straight from the column store */
+QVariant NuclideTableModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || this->table_ == nullptr) return QVariant();
+    if (index.row() < 0 || index.row() >= this->selection_.size()) return QVariant();
+
+    if (role == Qt::TextAlignmentRole) {
+        if (index.column() == ColumnSymbol) return int(Qt::AlignLeft | Qt::AlignVCenter);
+        return int(Qt::AlignRight | Qt::AlignVCenter);
+    }
+    if (role != Qt::DisplayRole) return QVariant();
+
+    const NuclideTable &nuclides = *this->table_;
+    const int row = this->selection_.row(index.row());
+    switch (index.column()) {
+    case ColumnNeutrons: return QString::number(nuclides.neutrons()[row]);
+    case ColumnProtons: return QString::number(nuclides.protons()[row]);
+    case ColumnNucleons: return QString::number(nuclides.nucleons()[row]);
+    case ColumnSymbol: return QString::fromLatin1(nuclides.element(row));
+    case ColumnBindingEnergy: return QString::number(nuclides.bindingEnergy()[row], 'g', 12);
+    case ColumnBindingEnergyUncertainty: return QString::number(nuclides.bindingEnergyUncertainty()[row], 'g', 12);
+    case ColumnAtomicMass: return QString::number(nuclides.atomicMass()[row], 'g', 12);
+    case ColumnAtomicMassUncertainty: return QString::number(nuclides.atomicMassUncertainty()[row], 'g', 12);
+    default: return QVariant();
+    }
+}
+
+QVariant NuclideTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (role != Qt::DisplayRole) return QVariant();
+    if (orientation == Qt::Vertical) return QString::number(section + 1);
+
+    switch (section) {
+    case ColumnNeutrons: return QString("Neutons");
+    case ColumnProtons: return QString("Protons");
+    case ColumnNucleons: return QString("A");
+    case ColumnSymbol: return QString("Symbol");
+    case ColumnBindingEnergy: return QString("Binding Energy");
+    case ColumnBindingEnergyUncertainty: return QString("Uncertainty");
+    case ColumnAtomicMass: return QString("Atomic Mass");
+    case ColumnAtomicMassUncertainty: return QString("Uncertainty");
+    default: return QVariant();
+    }
+}
@@ -0,0 +1,43 @@
+#ifndef NUCLIDETABLEMODEL_H
+#define NUCLIDETABLEMODEL_H
+
+#include <QAbstractTableModel>
+#include "nuclideselection.h"
+#include "nuclidetable.h"
+
+/*
+ * Read-only model over the nuclide table for the data tab. Nothing is copied - each cell is
+ * formatted from the column store when the view asks for it, so only the visible rows ever
+ * cost any time or memory. Sorting and filtering go through a NuclideSelection, which maps
+ * model rows to table rows, so the view sorts without a proxy model. The table is owned
+ * elsewhere and must outlive the model, or be replaced with setTable() first.
+ */
+class NuclideTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    explicit NuclideTableModel(QObject *parent = nullptr);
+
+    /* show a new table - pass nullptr to empty the model */
+    void setTable(const NuclideTable *table);
+    const NuclideTable *table() const { return this->table_; }
+
+    /* show only the nuclides accepted by the filter */
+    void setFilter(const NuclideFilter &filter);
+
+    /* returns the table row shown in a model row */
+    int tableRow(int row) const { return this->selection_.row(row); }
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) override;
+
+private:
+    const NuclideTable *table_;
+    NuclideSelection selection_;
+    NuclideFilter filter_;
+};
+#endif // NUCLIDETABLEMODEL_H
@@ -24,6 +24,7 @@
 ****************************************************************************/
 
 #include "qcustomplot.h"
+#include "colorizekernel.h"
 
 
 /* including file 'src/vector2d.cpp', size 7340                              */
@@ -15923,6 +15924,9 @@ void QCPColorGradient::setPeriodic(bool enabled)
 
   The QRgb values that are placed in \a scanLine have their r, g and b components premultiplied
   with alpha (see QImage::Format_ARGB32_Premultiplied).
+  
+  Non-periodic gradients are colorized by the vectorized kernels in colorizekernel.h (AVX2 or SSE2,
+  chosen at runtime, with a scalar fallback). Periodic gradients use the scalar loops below.
 */
 void QCPColorGradient::colorize(const double *data, const QCPRange &range, QRgb *scanLine, int n, int dataIndexFactor, bool logarithmic)
 {
@@ -15954,15 +15958,7 @@ void QCPColorGradient::colorize(const double *data, const QCPRange &range, QRgb
       }
     } else
     {
-      for (int i=0; i<n; ++i)
-      {
-        int index = (data[dataIndexFactor*i]-range.lower)*posToIndexFactor;
-        if (index < 0)
-          index = 0;
-        else if (index >= mLevelCount)
-          index = mLevelCount-1;
-        scanLine[i] = mColorBuffer.at(index);
-      }
+      colorizeLinear(data, dataIndexFactor, n, range.lower, posToIndexFactor, reinterpret_cast<const std::uint32_t*>(mColorBuffer.constData()), mLevelCount, reinterpret_cast<std::uint32_t*>(scanLine));
     }
   } else // logarithmic == true
   {
@@ -15977,15 +15973,7 @@ void QCPColorGradient::colorize(const double *data, const QCPRange &range, QRgb
       }
     } else
     {
-      for (int i=0; i<n; ++i)
-      {
-        int index = qLn(data[dataIndexFactor*i]/range.lower)/qLn(range.upper/range.lower)*(mLevelCount-1);
-        if (index < 0)
-          index = 0;
-        else if (index >= mLevelCount)
-          index = mLevelCount-1;
-        scanLine[i] = mColorBuffer.at(index);
-      }
+      colorizeLogarithmic(data, dataIndexFactor, n, range.lower, qLn(range.upper/range.lower), reinterpret_cast<const std::uint32_t*>(mColorBuffer.constData()), mLevelCount, reinterpret_cast<std::uint32_t*>(scanLine));
     }
   }
 }
@@ -16041,23 +16029,8 @@ void QCPColorGradient::colorize(const double *data, const unsigned char *alpha,
       }
     } else
     {
-      for (int i=0; i<n; ++i)
-      {
-        int index = (data[dataIndexFactor*i]-range.lower)*posToIndexFactor;
-        if (index < 0)
-          index = 0;
-        else if (index >= mLevelCount)
-          index = mLevelCount-1;
-        if (alpha[dataIndexFactor*i] == 255)
-        {
-          scanLine[i] = mColorBuffer.at(index);
-        } else
-        {
-          const QRgb rgb = mColorBuffer.at(index);
-          const float alphaF = alpha[dataIndexFactor*i]/255.0f;
-          scanLine[i] = qRgba(qRed(rgb)*alphaF, qGreen(rgb)*alphaF, qBlue(rgb)*alphaF, qAlpha(rgb)*alphaF);
-        }
-      }
+      colorizeLinear(data, dataIndexFactor, n, range.lower, posToIndexFactor, reinterpret_cast<const std::uint32_t*>(mColorBuffer.constData()), mLevelCount, reinterpret_cast<std::uint32_t*>(scanLine));
+      colorizeApplyAlpha(alpha, dataIndexFactor, n, reinterpret_cast<std::uint32_t*>(scanLine));
     }
   } else // logarithmic == true
   {
@@ -16080,23 +16053,8 @@ void QCPColorGradient::colorize(const double *data, const unsigned char *alpha,
       }
     } else
     {
-      for (int i=0; i<n; ++i)
-      {
-        int index = qLn(data[dataIndexFactor*i]/range.lower)/qLn(range.upper/range.lower)*(mLevelCount-1);
-        if (index < 0)
-          index = 0;
-        else if (index >= mLevelCount)
-          index = mLevelCount-1;
-        if (alpha[dataIndexFactor*i] == 255)
-        {
-          scanLine[i] = mColorBuffer.at(index);
-        } else
-        {
-          const QRgb rgb = mColorBuffer.at(index);
-          const float alphaF = alpha[dataIndexFactor*i]/255.0f;
-          scanLine[i] = qRgba(qRed(rgb)*alphaF, qGreen(rgb)*alphaF, qBlue(rgb)*alphaF, qAlpha(rgb)*alphaF);
-        }
-      }
+      colorizeLogarithmic(data, dataIndexFactor, n, range.lower, qLn(range.upper/range.lower), reinterpret_cast<const std::uint32_t*>(mColorBuffer.constData()), mLevelCount, reinterpret_cast<std::uint32_t*>(scanLine));
+      colorizeApplyAlpha(alpha, dataIndexFactor, n, reinterpret_cast<std::uint32_t*>(scanLine));
     }
   }
 }
@@ -20118,6 +20076,7 @@ QCPGraph::QCPGraph(QCPAxis *keyAxis, QCPAxis *valueAxis) :
   setScatterSkip(0);
   setChannelFillGraph(0);
   setAdaptiveSampling(true);
+  setScatterStamping(false);
 }
 
 QCPGraph::~QCPGraph()
@@ -20264,6 +20223,28 @@ void QCPGraph::setAdaptiveSampling(bool enabled)
   mAdaptiveSampling = enabled;
 }
 
+/*!
+  Sets whether scatters are drawn by stamping. The scatter shape is then rendered once into a
+  pixmap, and that pixmap is drawn at most once per pixel of the axis rect, no matter how many data
+  points fall into the pixel. This keeps dense scatter plots of hundreds of thousands of points
+  fast to replot and drag, as the cost is bounded by the number of covered pixels rather than the
+  number of points.
+  
+  Scatters are placed on whole pixels when stamping, so they may shift by up to half a pixel. For
+  exports (\ref QCustomPlot::savePdf, \ref QCustomPlot::savePng etc.) the scatters are drawn
+  individually as usual.
+  
+  Stamping is disabled by default.
+  
+  \see setAdaptiveSampling, setScatterStyle
+*/
+void QCPGraph::setScatterStamping(bool enabled)
+{
+  mScatterStamping = enabled;
+  if (!enabled)
+    mScatterStamps.clear();
+}
+
 /*! \overload
   
   Adds the provided points in \a keys and \a values to the current data. The provided vectors
@@ -20848,12 +20829,116 @@ void QCPGraph::drawFill(QCPPainter *painter, QVector<QPointF> *lines) const
 */
 void QCPGraph::drawScatterPlot(QCPPainter *painter, const QVector<QPointF> &scatters, const QCPScatterStyle &style) const
 {
+  if (mScatterStamping && !painter->modes().testFlag(QCPPainter::pmVectorized) && !painter->modes().testFlag(QCPPainter::pmNoCaching))
+  {
+    drawStampedScatters(painter, scatters, style);
+    return;
+  }
   applyScattersAntialiasingHint(painter);
   style.applyTo(painter, mPen);
   for (int i=0; i<scatters.size(); ++i)
     style.drawShape(painter, scatters.at(i).x(), scatters.at(i).y());
 }
 
+/*! \internal
+
+  Draws the scatters in \a scatters with the pixmap stamp of \a style (see \ref
+  getScatterStamp), rounding each scatter to the nearest pixel. An occupancy bitmap over the clip
+  rect, extended by the stamp radius, makes sure every pixel is stamped only once, and scatters
+  outside of it are skipped as they wouldn't be visible anyway.
+
+  \see setScatterStamping
+*/
+void QCPGraph::drawStampedScatters(QCPPainter *painter, const QVector<QPointF> &scatters, const QCPScatterStyle &style) const
+{
+  applyScattersAntialiasingHint(painter);
+  const ScatterStamp &stamp = getScatterStamp(style, painter->antialiasing());
+  const QRect grid = clipRect().adjusted(-stamp.radius, -stamp.radius, stamp.radius, stamp.radius);
+  const int gridWidth = grid.width();
+  const int gridHeight = grid.height();
+  if (gridWidth <= 0 || gridHeight <= 0)
+    return;
+  QVector<quint32> occupied((gridWidth*gridHeight+31)/32, 0);
+  for (int i=0; i<scatters.size(); ++i)
+  {
+    const double x = scatters.at(i).x()-grid.left()+0.5;
+    const double y = scatters.at(i).y()-grid.top()+0.5;
+    if (!(x >= 0 && x < gridWidth && y >= 0 && y < gridHeight)) // also rejects NaN
+      continue;
+    const int cell = int(y)*gridWidth+int(x);
+    if (occupied.at(cell >> 5) & (1u << (cell & 31)))
+      continue;
+    occupied[cell >> 5] |= 1u << (cell & 31);
+    painter->drawPixmap(grid.left()+int(x)-stamp.radius, grid.top()+int(y)-stamp.radius, stamp.pixmap);
+  }
+}
+
+/*! \internal
+
+  Returns the pixmap stamp of \a style as drawn with the graph pen (if \a style has no pen of its
+  own) and with or without \a antialiased edges. The scatter shape is centered in the pixmap, \a
+  radius pixels away from its top left corner. Stamps are cached, the two most recently used ones
+  are kept so drawing selected and unselected segments with different styles doesn't re-render
+  them on every replot.
+*/
+const QCPGraph::ScatterStamp &QCPGraph::getScatterStamp(const QCPScatterStyle &style, bool antialiased) const
+{
+  const QPen pen = style.isPenDefined() ? style.pen() : mPen;
+  const double devicePixelRatio = mParentPlot ? mParentPlot->bufferDevicePixelRatio() : 1.0;
+  for (int i=0; i<mScatterStamps.size(); ++i)
+  {
+    const ScatterStamp &stamp = mScatterStamps.at(i);
+    if (stamp.style.shape() == style.shape() && stamp.style.size() == style.size() &&
+        stamp.style.brush() == style.brush() && stamp.pen == pen &&
+        stamp.style.pixmap().cacheKey() == style.pixmap().cacheKey() &&
+        stamp.style.customPath() == style.customPath() &&
+        stamp.antialiased == antialiased && qFuzzyCompare(stamp.devicePixelRatio, devicePixelRatio))
+    {
+      if (i != mScatterStamps.size()-1)
+        mScatterStamps.move(i, mScatterStamps.size()-1);
+      return mScatterStamps.last();
+    }
+  }
+  
+  ScatterStamp stamp;
+  stamp.style = style;
+  stamp.pen = pen;
+  stamp.antialiased = antialiased;
+  stamp.devicePixelRatio = devicePixelRatio;
+  // half the extent of the shape around its center:
+  double extent = style.size()*0.5;
+  if (style.shape() == QCPScatterStyle::ssPixmap)
+  {
+    extent = qMax(style.pixmap().width(), style.pixmap().height())*0.5;
+  } else if (style.shape() == QCPScatterStyle::ssCustom)
+  {
+    const QRectF bounds = style.customPath().boundingRect();
+    extent = qMax(qMax(qAbs(bounds.left()), qAbs(bounds.right())), qMax(qAbs(bounds.top()), qAbs(bounds.bottom())))*style.size()/6.0;
+  }
+  const double penWidth = pen.style() == Qt::NoPen ? 0 : qMax(1.0, pen.widthF());
+  stamp.radius = qCeil(extent+penWidth*0.5)+1; // one more pixel for the antialiased edge
+  const int stampSize = 2*stamp.radius+1;
+  if (!qFuzzyCompare(1.0, devicePixelRatio))
+  {
+    stamp.pixmap = QPixmap(QSize(stampSize, stampSize)*devicePixelRatio);
+#ifdef QCP_DEVICEPIXELRATIO_SUPPORTED
+    stamp.pixmap.setDevicePixelRatio(devicePixelRatio);
+#endif
+  } else
+    stamp.pixmap = QPixmap(stampSize, stampSize);
+  stamp.pixmap.fill(Qt::transparent);
+  QCPPainter stampPainter(&stamp.pixmap);
+  stampPainter.setAntialiasing(antialiased);
+  style.applyTo(&stampPainter, mPen);
+  style.drawShape(&stampPainter, stamp.radius, stamp.radius);
+  stampPainter.end();
+  
+  if (mScatterStamps.size() >= 2)
+    mScatterStamps.removeFirst();
+  mScatterStamps.append(stamp);
+  return mScatterStamps.last();
+}
+
 /*!  \internal
   
   Draws lines between the points in \a lines, given in pixel coordinates.
@@ -20901,6 +20986,11 @@ void QCPGraph::drawImpulsePlot(QCPPainter *painter, const QVector<QPointF> &line
 
   This method is used by \ref getLines to retrieve the basic working set of data.
 
+  If the data container has its min/max pyramid enabled (\ref QCPDataContainer::setMinMaxPyramid),
+  the adaptive sampling binary searches the end of each pixel interval and takes the value span of
+  the interval from the pyramid, so it costs O(pixels log n) instead of visiting every point. The
+  resulting line is the same.
+
   \see getOptimizedScatterData
 */
 void QCPGraph::getOptimizedLineData(QVector<QCPGraphData> *lineData, const QCPGraphDataContainer::const_iterator &begin, const QCPGraphDataContainer::const_iterator &end) const
@@ -20920,7 +21010,46 @@ void QCPGraph::getOptimizedLineData(QVector<QCPGraphData> *lineData, const QCPGr
       maxCount = 2*keyPixelSpan+2;
   }
   
-  if (mAdaptiveSampling && dataCount >= maxCount) // use adaptive sampling only if there are at least two points per pixel on average
+  if (mAdaptiveSampling && dataCount >= maxCount && mDataContainer->minMaxPyramid()) // same sampling as below, but jumping to the end of each pixel interval and taking its value span from the min/max pyramid
+  {
+    QCPGraphDataContainer::const_iterator currentIntervalFirstPoint = begin;
+    int reversedFactor = keyAxis->pixelOrientation(); // is used to calculate keyEpsilon pixel into the correct direction
+    int reversedRound = reversedFactor==-1 ? 1 : 0; // is used to switch between floor (normal) and ceil (reversed) rounding of currentIntervalStartKey
+    double currentIntervalStartKey = keyAxis->pixelToCoord((int)(keyAxis->coordToPixel(begin->key)+reversedRound));
+    double lastIntervalEndKey = currentIntervalStartKey;
+    double keyEpsilon = qAbs(currentIntervalStartKey-keyAxis->pixelToCoord(keyAxis->coordToPixel(currentIntervalStartKey)+1.0*reversedFactor)); // interval of one pixel on screen when mapped to plot key coordinates
+    bool keyEpsilonVariable = keyAxis->scaleType() == QCPAxis::stLogarithmic; // indicates whether keyEpsilon needs to be updated after every interval (for log axes)
+    while (currentIntervalFirstPoint != end)
+    {
+      QCPGraphDataContainer::const_iterator intervalEnd = std::lower_bound(currentIntervalFirstPoint+1, end, QCPGraphData::fromSortKey(currentIntervalStartKey+keyEpsilon), qcpLessThanSortKey<QCPGraphData>);
+      if (intervalEnd-currentIntervalFirstPoint >= 2) // pixel has multiple data points, consolidate them to a cluster
+      {
+        // start from the first value like the linear scan, so a NaN first value carries through:
+        double minValue = currentIntervalFirstPoint->value;
+        double maxValue = currentIntervalFirstPoint->value;
+        QCPRange valueSpan = mDataContainer->mainValueRange(currentIntervalFirstPoint+1, intervalEnd);
+        if (valueSpan.lower < minValue)
+          minValue = valueSpan.lower;
+        if (valueSpan.upper > maxValue)
+          maxValue = valueSpan.upper;
+        if (lastIntervalEndKey < currentIntervalStartKey-keyEpsilon) // last point is further away, so first point of this cluster must be at a real data point
+          lineData->append(QCPGraphData(currentIntervalStartKey+keyEpsilon*0.2, currentIntervalFirstPoint->value));
+        lineData->append(QCPGraphData(currentIntervalStartKey+keyEpsilon*0.25, minValue));
+        lineData->append(QCPGraphData(currentIntervalStartKey+keyEpsilon*0.75, maxValue));
+        if (intervalEnd != end && intervalEnd->key > currentIntervalStartKey+keyEpsilon*2) // new pixel started further away from previous cluster, so make sure the last point of the cluster is at a real data point
+          lineData->append(QCPGraphData(currentIntervalStartKey+keyEpsilon*0.8, (intervalEnd-1)->value));
+      } else
+        lineData->append(QCPGraphData(currentIntervalFirstPoint->key, currentIntervalFirstPoint->value));
+      lastIntervalEndKey = (intervalEnd-1)->key;
+      currentIntervalFirstPoint = intervalEnd;
+      if (intervalEnd != end)
+      {
+        currentIntervalStartKey = keyAxis->pixelToCoord((int)(keyAxis->coordToPixel(intervalEnd->key)+reversedRound));
+        if (keyEpsilonVariable)
+          keyEpsilon = qAbs(currentIntervalStartKey-keyAxis->pixelToCoord(keyAxis->coordToPixel(currentIntervalStartKey)+1.0*reversedFactor));
+      }
+    }
+  } else if (mAdaptiveSampling && dataCount >= maxCount) // use adaptive sampling only if there are at least two points per pixel on average
   {
     QCPGraphDataContainer::const_iterator it = begin;
     double minValue = it->value;
@@ -25022,6 +25151,11 @@ QVector<QLineF> QCPStatisticalBox::getWhiskerBarLines(QCPStatisticalBoxDataConta
   fillAlpha and \ref clearAlpha. The memory for the alpha map is only allocated if needed, i.e. on
   the first call of \ref setAlpha. \ref clearAlpha restores full opacity and frees the alpha map.
   
+  Changes made cell by cell (\ref setCell, \ref setData, \ref setAlpha) are tracked as one span of
+  dirty cells per row and per column of the map, so the next \ref QCPColorMap::updateMapImage only
+  colorizes those spans again instead of the whole image. Operations which touch every cell (\ref
+  setSize, \ref fill, \ref fillAlpha, \ref clearAlpha, assignment) still invalidate the whole map.
+  
   This class also buffers the minimum and maximum values that are in the data set, to provide
   QCPColorMap::rescaleDataRange with the necessary information quickly. Setting a cell to a value
   that is greater than the current maximum increases this maximum to the new value. However,
@@ -25059,7 +25193,8 @@ QCPColorMapData::QCPColorMapData(int keySize, int valueSize, const QCPRange &key
   mIsEmpty(true),
   mData(0),
   mAlpha(0),
-  mDataModified(true)
+  mDataModified(true),
+  mCellsDirty(false)
 {
   setSize(keySize, valueSize);
   fill(0);
@@ -25082,7 +25217,8 @@ QCPColorMapData::QCPColorMapData(const QCPColorMapData &other) :
   mIsEmpty(true),
   mData(0),
   mAlpha(0),
-  mDataModified(true)
+  mDataModified(true),
+  mCellsDirty(false)
 {
   *this = other;
 }
@@ -25294,7 +25430,7 @@ void QCPColorMapData::setData(double key, double value, double z)
       mDataBounds.lower = z;
     if (z > mDataBounds.upper)
       mDataBounds.upper = z;
-     mDataModified = true;
+    markCellDirty(keyCell, valueCell);
   }
 }
 
@@ -25318,7 +25454,7 @@ void QCPColorMapData::setCell(int keyIndex, int valueIndex, double z)
       mDataBounds.lower = z;
     if (z > mDataBounds.upper)
       mDataBounds.upper = z;
-     mDataModified = true;
+    markCellDirty(keyIndex, valueIndex);
   } else
     qDebug() << Q_FUNC_INFO << "index out of bounds:" << keyIndex << valueIndex;
 }
@@ -25345,7 +25481,7 @@ void QCPColorMapData::setAlpha(int keyIndex, int valueIndex, unsigned char alpha
     if (mAlpha || createAlpha())
     {
       mAlpha[valueIndex*mKeySize + keyIndex] = alpha;
-      mDataModified = true;
+      markCellDirty(keyIndex, valueIndex);
     }
   } else
     qDebug() << Q_FUNC_INFO << "index out of bounds:" << keyIndex << valueIndex;
@@ -25524,6 +25660,53 @@ bool QCPColorMapData::createAlpha(bool initializeOpaque)
   }
 }
 
+/*! \internal
+  
+  Records that the cell at \a keyIndex and \a valueIndex has changed. The cell widens the dirty
+  key span of its value row and the dirty value span of its key column, so \ref
+  QCPColorMap::updateMapImage can recolorize just those spans whichever axis orientation is used.
+  Nothing is recorded while the whole map is invalidated anyway.
+  
+  \see clearDirtyCells
+*/
+void QCPColorMapData::markCellDirty(int keyIndex, int valueIndex)
+{
+  if (mDataModified)
+    return;
+  if (mDirtyKeyLower.size() != mValueSize || mDirtyValueLower.size() != mKeySize)
+  {
+    mDirtyKeyLower.fill(mKeySize, mValueSize);
+    mDirtyKeyUpper.fill(-1, mValueSize);
+    mDirtyValueLower.fill(mValueSize, mKeySize);
+    mDirtyValueUpper.fill(-1, mKeySize);
+  }
+  mDirtyKeyLower[valueIndex] = qMin(mDirtyKeyLower.at(valueIndex), keyIndex);
+  mDirtyKeyUpper[valueIndex] = qMax(mDirtyKeyUpper.at(valueIndex), keyIndex);
+  mDirtyValueLower[keyIndex] = qMin(mDirtyValueLower.at(keyIndex), valueIndex);
+  mDirtyValueUpper[keyIndex] = qMax(mDirtyValueUpper.at(keyIndex), valueIndex);
+  mCellsDirty = true;
+}
+
+/*! \internal
+  
+  Marks every cell as clean. Called by \ref QCPColorMap::updateMapImage once the map image reflects
+  the data again.
+  
+  \see markCellDirty
+*/
+void QCPColorMapData::clearDirtyCells()
+{
+  if (mCellsDirty)
+  {
+    mDirtyKeyLower.fill(mKeySize, mValueSize);
+    mDirtyKeyUpper.fill(-1, mValueSize);
+    mDirtyValueLower.fill(mValueSize, mKeySize);
+    mDirtyValueUpper.fill(-1, mKeySize);
+    mCellsDirty = false;
+  }
+  mDataModified = false;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 //////////////////// QCPColorMap
@@ -25960,6 +26143,10 @@ QCPRange QCPColorMap::getValueRange(bool &foundRange, QCP::SignDomain inSignDoma
   QPainter::drawImage bug which makes inner pixel boundaries jitter when stretch-drawing images
   without smooth transform enabled. Accordingly, oversampling isn't performed if \ref
   setInterpolate is true.
+  
+  If only individual cells have changed since the last update (see \ref QCPColorMapData::setCell)
+  and the image is otherwise still valid, only the dirty span of each affected scanline is
+  colorized again and copied into the oversampled image.
 */
 void QCPColorMap::updateMapImage()
 {
@@ -25972,12 +26159,18 @@ void QCPColorMap::updateMapImage()
   const int valueSize = mMapData->valueSize();
   int keyOversamplingFactor = mInterpolate ? 1 : (int)(1.0+100.0/(double)keySize); // make mMapImage have at least size 100, factor becomes 1 if size > 200 or interpolation is on
   int valueOversamplingFactor = mInterpolate ? 1 : (int)(1.0+100.0/(double)valueSize); // make mMapImage have at least size 100, factor becomes 1 if size > 200 or interpolation is on
+  bool fullUpdate = mMapData->mDataModified || mMapImageInvalidated;
   
   // resize mMapImage to correct dimensions including possible oversampling factors, according to key/value axes orientation:
   if (keyAxis->orientation() == Qt::Horizontal && (mMapImage.width() != keySize*keyOversamplingFactor || mMapImage.height() != valueSize*valueOversamplingFactor))
+  {
     mMapImage = QImage(QSize(keySize*keyOversamplingFactor, valueSize*valueOversamplingFactor), format);
-  else if (keyAxis->orientation() == Qt::Vertical && (mMapImage.width() != valueSize*valueOversamplingFactor || mMapImage.height() != keySize*keyOversamplingFactor))
+    fullUpdate = true;
+  } else if (keyAxis->orientation() == Qt::Vertical && (mMapImage.width() != valueSize*valueOversamplingFactor || mMapImage.height() != keySize*keyOversamplingFactor))
+  {
     mMapImage = QImage(QSize(valueSize*valueOversamplingFactor, keySize*keyOversamplingFactor), format);
+    fullUpdate = true;
+  }
   
   if (mMapImage.isNull())
   {
@@ -25991,50 +26184,76 @@ void QCPColorMap::updateMapImage()
     {
       // resize undersampled map image to actual key/value cell sizes:
       if (keyAxis->orientation() == Qt::Horizontal && (mUndersampledMapImage.width() != keySize || mUndersampledMapImage.height() != valueSize))
+      {
         mUndersampledMapImage = QImage(QSize(keySize, valueSize), format);
-      else if (keyAxis->orientation() == Qt::Vertical && (mUndersampledMapImage.width() != valueSize || mUndersampledMapImage.height() != keySize))
+        fullUpdate = true;
+      } else if (keyAxis->orientation() == Qt::Vertical && (mUndersampledMapImage.width() != valueSize || mUndersampledMapImage.height() != keySize))
+      {
         mUndersampledMapImage = QImage(QSize(valueSize, keySize), format);
+        fullUpdate = true;
+      }
       localMapImage = &mUndersampledMapImage; // make the colorization run on the undersampled image
     } else if (!mUndersampledMapImage.isNull())
       mUndersampledMapImage = QImage(); // don't need oversampling mechanism anymore (map size has changed) but mUndersampledMapImage still has nonzero size, free it
     
     const double *rawData = mMapData->mData;
     const unsigned char *rawAlpha = mMapData->mAlpha;
-    if (keyAxis->orientation() == Qt::Horizontal)
+    const bool logarithmic = mDataScaleType==QCPAxis::stLogarithmic;
+    
+    // a scanline runs along the key axis if it is horizontal, else along the value axis. Each scanline colorizes
+    // the span [lower, upper] of its cells, which is the whole line on a full update and the dirty span otherwise:
+    const bool horizontal = keyAxis->orientation() == Qt::Horizontal;
+    const int lineCount = horizontal ? valueSize : keySize;
+    const int rowCount = horizontal ? keySize : valueSize;
+    const int cellStride = horizontal ? 1 : keySize; // distance in the data array between neighbouring cells of a scanline
+    const int lineStride = horizontal ? keySize : 1; // distance in the data array between the first cells of neighbouring scanlines
+    const QVector<int> &dirtyLower = horizontal ? mMapData->mDirtyKeyLower : mMapData->mDirtyValueLower;
+    const QVector<int> &dirtyUpper = horizontal ? mMapData->mDirtyKeyUpper : mMapData->mDirtyValueUpper;
+    const int xFactor = horizontal ? keyOversamplingFactor : valueOversamplingFactor;
+    const int yFactor = horizontal ? valueOversamplingFactor : keyOversamplingFactor;
+    const bool oversampled = localMapImage != &mMapImage;
+    
+    for (int line=0; line<lineCount; ++line)
     {
-      const int lineCount = valueSize;
-      const int rowCount = keySize;
-      for (int line=0; line<lineCount; ++line)
+      int lower = 0, upper = rowCount-1;
+      if (!fullUpdate)
       {
-        QRgb* pixels = reinterpret_cast<QRgb*>(localMapImage->scanLine(lineCount-1-line)); // invert scanline index because QImage counts scanlines from top, but our vertical index counts from bottom (mathematical coordinate system)
-        if (rawAlpha)
-          mGradient.colorize(rawData+line*rowCount, rawAlpha+line*rowCount, mDataRange, pixels, rowCount, 1, mDataScaleType==QCPAxis::stLogarithmic);
-        else
-          mGradient.colorize(rawData+line*rowCount, mDataRange, pixels, rowCount, 1, mDataScaleType==QCPAxis::stLogarithmic);
+        if (!mMapData->mCellsDirty || line >= dirtyLower.size() || dirtyLower.at(line) > dirtyUpper.at(line))
+          continue;
+        lower = dirtyLower.at(line);
+        upper = dirtyUpper.at(line);
       }
-    } else // keyAxis->orientation() == Qt::Vertical
-    {
-      const int lineCount = keySize;
-      const int rowCount = valueSize;
-      for (int line=0; line<lineCount; ++line)
+      const int count = upper-lower+1;
+      const int offset = line*lineStride + lower*cellStride;
+      const int y = lineCount-1-line; // invert scanline index because QImage counts scanlines from top, but our vertical index counts from bottom (mathematical coordinate system)
+      QRgb* pixels = reinterpret_cast<QRgb*>(localMapImage->scanLine(y));
+      if (rawAlpha)
+        mGradient.colorize(rawData+offset, rawAlpha+offset, mDataRange, pixels+lower, count, cellStride, logarithmic);
+      else
+        mGradient.colorize(rawData+offset, mDataRange, pixels+lower, count, cellStride, logarithmic);
+      
+      // on a partial update, copy the recolorized span into the oversampled image as blocks of xFactor*yFactor pixels:
+      if (!fullUpdate && oversampled)
       {
-        QRgb* pixels = reinterpret_cast<QRgb*>(localMapImage->scanLine(lineCount-1-line)); // invert scanline index because QImage counts scanlines from top, but our vertical index counts from bottom (mathematical coordinate system)
-        if (rawAlpha)
-          mGradient.colorize(rawData+line, rawAlpha+line, mDataRange, pixels, rowCount, lineCount, mDataScaleType==QCPAxis::stLogarithmic);
-        else
-          mGradient.colorize(rawData+line, mDataRange, pixels, rowCount, lineCount, mDataScaleType==QCPAxis::stLogarithmic);
+        for (int yOffset=0; yOffset<yFactor; ++yOffset)
+        {
+          QRgb* target = reinterpret_cast<QRgb*>(mMapImage.scanLine(y*yFactor+yOffset)) + lower*xFactor;
+          for (int i=0; i<count; ++i)
+            for (int xOffset=0; xOffset<xFactor; ++xOffset)
+              *target++ = pixels[lower+i];
+        }
       }
     }
     
-    if (keyOversamplingFactor > 1 || valueOversamplingFactor > 1)
+    if (fullUpdate && oversampled)
     {
-      if (keyAxis->orientation() == Qt::Horizontal)
+      if (horizontal)
         mMapImage = mUndersampledMapImage.scaled(keySize*keyOversamplingFactor, valueSize*valueOversamplingFactor, Qt::IgnoreAspectRatio, Qt::FastTransformation);
       else
         mMapImage = mUndersampledMapImage.scaled(valueSize*valueOversamplingFactor, keySize*keyOversamplingFactor, Qt::IgnoreAspectRatio, Qt::FastTransformation);
     }
   }
-  mMapData->mDataModified = false;
+  mMapData->clearDirtyCells();
   mMapImageInvalidated = false;
 }
 
@@ -26045,7 +26264,7 @@ void QCPColorMap::draw(QCPPainter *painter)
   if (!mKeyAxis || !mValueAxis) return;
   applyDefaultAntialiasingHint(painter);
   
-  if (mMapData->mDataModified || mMapImageInvalidated)
+  if (mMapData->mDataModified || mMapData->mCellsDirty || mMapImageInvalidated)
     updateMapImage();
   
   // use buffer if painting vectorized (PDF):
@@ -2451,18 +2451,31 @@ public:
   QCPDataRange dataRange() const { return QCPDataRange(0, size()); }
   void limitIteratorsToDataRange(const_iterator &begin, const_iterator &end, const QCPDataRange &dataRange) const;
   
+  // min/max pyramid:
+  bool minMaxPyramid() const { return mMinMaxPyramid; }
+  void setMinMaxPyramid(bool enabled);
+  void invalidateMinMaxPyramid();
+  QCPRange mainValueRange(const_iterator begin, const_iterator end) const;
+  
 protected:
   // property members:
   bool mAutoSqueeze;
+  bool mMinMaxPyramid;
   
   // non-property memebers:
   QVector<DataType> mData;
   int mPreallocSize;
   int mPreallocIteration;
+  mutable QVector<QVector<QCPRange> > mPyramid; // level l holds the main value range of blocks of (pyramidBlockSize << l) entries of mData, aligned to the start of mData
+  mutable int mPyramidDataSize; // size of mData when the pyramid was last brought up to date
+  mutable int mPyramidDirtyBegin, mPyramidDirtyEnd; // entries of mData changed since then
+  static const int pyramidBlockSize = 16;
   
   // non-virtual methods:
   void preallocateGrow(int minimumPreallocSize);
   void performAutoSqueeze();
+  void markPyramidDirty(int dataIndexBegin, int dataIndexEnd);
+  void updateMinMaxPyramid() const;
 };
 
 // include implementation in header since it is a class template:
@@ -2503,6 +2516,13 @@ protected:
   sort. Failing to do so can not be detected by the container efficiently and will cause both
   rendering artifacts and potential data loss.
 
+  For long series the container can maintain a min/max pyramid of the main values (see \ref
+  setMinMaxPyramid). The pyramid holds the value range of aligned blocks of data points at every
+  power-of-two block size, so \ref mainValueRange answers for any range of points in O(log n). It is
+  kept up to date by \ref set, \ref add and the remove methods, which only mark the changed part
+  for rebuilding. If values are changed in-place through the non-const iterators, call \ref
+  invalidateMinMaxPyramid afterwards.
+
   Implementing one-dimensional plottables that make use of a \ref QCPDataContainer<T> is usually
   done by subclassing from \ref QCPAbstractPlottable1D "QCPAbstractPlottable1D<T>", which
   introduces an according \a mDataContainer member and some convenience methods.
@@ -2606,8 +2626,12 @@ protected:
 template <class DataType>
 QCPDataContainer<DataType>::QCPDataContainer() :
   mAutoSqueeze(true),
+  mMinMaxPyramid(false),
   mPreallocSize(0),
-  mPreallocIteration(0)
+  mPreallocIteration(0),
+  mPyramidDataSize(0),
+  mPyramidDirtyBegin(0),
+  mPyramidDirtyEnd(0)
 {
 }
 
@@ -2658,6 +2682,7 @@ void QCPDataContainer<DataType>::set(const QVector<DataType> &data, bool already
   mData = data;
   mPreallocSize = 0;
   mPreallocIteration = 0;
+  invalidateMinMaxPyramid();
   if (!alreadySorted)
     sort();
 }
@@ -2683,12 +2708,18 @@ void QCPDataContainer<DataType>::add(const QCPDataContainer<DataType> &data)
       preallocateGrow(n);
     mPreallocSize -= n;
     std::copy(data.constBegin(), data.constEnd(), begin());
+    markPyramidDirty(mPreallocSize, mPreallocSize+n);
   } else // don't need to prepend, so append and merge if necessary
   {
     mData.resize(mData.size()+n);
     std::copy(data.constBegin(), data.constEnd(), end()-n);
+    int firstChanged = mData.size()-n;
     if (oldSize > 0 && !qcpLessThanSortKey<DataType>(*(constEnd()-n-1), *(constEnd()-n))) // if appended range keys aren't all greater than existing ones, merge the two partitions
+    {
+      firstChanged = std::upper_bound(constBegin(), constEnd()-n, *(constEnd()-n), qcpLessThanSortKey<DataType>)-mData.constBegin(); // points sorting before the first new one stay in place
       std::inplace_merge(begin(), end()-n, end(), qcpLessThanSortKey<DataType>);
+    }
+    markPyramidDirty(firstChanged, mData.size());
   }
 }
 
@@ -2720,14 +2751,20 @@ void QCPDataContainer<DataType>::add(const QVector<DataType> &data, bool already
       preallocateGrow(n);
     mPreallocSize -= n;
     std::copy(data.constBegin(), data.constEnd(), begin());
+    markPyramidDirty(mPreallocSize, mPreallocSize+n);
   } else // don't need to prepend, so append and then sort and merge if necessary
   {
     mData.resize(mData.size()+n);
     std::copy(data.constBegin(), data.constEnd(), end()-n);
     if (!alreadySorted) // sort appended subrange if it wasn't already sorted
       std::sort(end()-n, end(), qcpLessThanSortKey<DataType>);
+    int firstChanged = mData.size()-n;
     if (oldSize > 0 && !qcpLessThanSortKey<DataType>(*(constEnd()-n-1), *(constEnd()-n))) // if appended range keys aren't all greater than existing ones, merge the two partitions
+    {
+      firstChanged = std::upper_bound(constBegin(), constEnd()-n, *(constEnd()-n), qcpLessThanSortKey<DataType>)-mData.constBegin(); // points sorting before the first new one stay in place
       std::inplace_merge(begin(), end()-n, end(), qcpLessThanSortKey<DataType>);
+    }
+    markPyramidDirty(firstChanged, mData.size());
   }
 }
 
@@ -2743,16 +2780,20 @@ void QCPDataContainer<DataType>::add(const DataType &data)
   if (isEmpty() || !qcpLessThanSortKey<DataType>(data, *(constEnd()-1))) // quickly handle appends if new data key is greater or equal to existing ones
   {
     mData.append(data);
+    markPyramidDirty(mData.size()-1, mData.size());
   } else if (qcpLessThanSortKey<DataType>(data, *constBegin()))  // quickly handle prepends using preallocated space
   {
     if (mPreallocSize < 1)
       preallocateGrow(1);
     --mPreallocSize;
     *begin() = data;
+    markPyramidDirty(mPreallocSize, mPreallocSize+1);
   } else // handle inserts, maintaining sorted keys
   {
     QCPDataContainer<DataType>::iterator insertionPoint = std::lower_bound(begin(), end(), data, qcpLessThanSortKey<DataType>);
+    const int insertionIndex = insertionPoint-mData.begin();
     mData.insert(insertionPoint, data);
+    markPyramidDirty(insertionIndex, mData.size());
   }
 }
 
@@ -2782,6 +2823,7 @@ void QCPDataContainer<DataType>::removeAfter(double sortKey)
   QCPDataContainer<DataType>::iterator it = std::upper_bound(begin(), end(), DataType::fromSortKey(sortKey), qcpLessThanSortKey<DataType>);
   QCPDataContainer<DataType>::iterator itEnd = end();
   mData.erase(it, itEnd); // typically adds it to the postallocated block
+  markPyramidDirty(mData.size(), mData.size()); // the size change rebuilds the last block
   if (mAutoSqueeze)
     performAutoSqueeze();
 }
@@ -2801,7 +2843,9 @@ void QCPDataContainer<DataType>::remove(double sortKeyFrom, double sortKeyTo)
   
   QCPDataContainer<DataType>::iterator it = std::lower_bound(begin(), end(), DataType::fromSortKey(sortKeyFrom), qcpLessThanSortKey<DataType>);
   QCPDataContainer<DataType>::iterator itEnd = std::upper_bound(it, end(), DataType::fromSortKey(sortKeyTo), qcpLessThanSortKey<DataType>);
+  const int eraseIndex = it-mData.begin();
   mData.erase(it, itEnd);
+  markPyramidDirty(eraseIndex, mData.size());
   if (mAutoSqueeze)
     performAutoSqueeze();
 }
@@ -2824,7 +2868,11 @@ void QCPDataContainer<DataType>::remove(double sortKey)
     if (it == begin())
       ++mPreallocSize; // don't actually delete, just add it to the preallocated block (if it gets too large, squeeze will take care of it)
     else
+    {
+      const int eraseIndex = it-mData.begin();
       mData.erase(it);
+      markPyramidDirty(eraseIndex, mData.size());
+    }
   }
   if (mAutoSqueeze)
     performAutoSqueeze();
@@ -2841,6 +2889,7 @@ void QCPDataContainer<DataType>::clear()
   mData.clear();
   mPreallocIteration = 0;
   mPreallocSize = 0;
+  invalidateMinMaxPyramid();
 }
 
 /*!
@@ -2858,6 +2907,7 @@ template <class DataType>
 void QCPDataContainer<DataType>::sort()
 {
   std::sort(begin(), end(), qcpLessThanSortKey<DataType>);
+  invalidateMinMaxPyramid();
 }
 
 /*!
@@ -2880,6 +2930,7 @@ void QCPDataContainer<DataType>::squeeze(bool preAllocation, bool postAllocation
       std::copy(begin(), end(), mData.begin());
       mData.resize(size());
       mPreallocSize = 0;
+      invalidateMinMaxPyramid(); // the points moved to the front of mData
     }
     mPreallocIteration = 0;
   }
@@ -3199,6 +3250,7 @@ void QCPDataContainer<DataType>::preallocateGrow(int minimumPreallocSize)
   mData.resize(mData.size()+sizeDifference);
   std::copy_backward(mData.begin()+mPreallocSize, mData.end()-sizeDifference, mData.end());
   mPreallocSize = newPreallocSize;
+  invalidateMinMaxPyramid(); // the points moved back in mData
 }
 
 /*! \internal
@@ -3236,6 +3288,218 @@ void QCPDataContainer<DataType>::performAutoSqueeze()
   if (shrinkPreAllocation || shrinkPostAllocation)
     squeeze(shrinkPreAllocation, shrinkPostAllocation);
 }
+
+/*!
+  Sets whether this container maintains a min/max pyramid of the main values of its data points,
+  which lets \ref mainValueRange find the value range of any range of points in O(log n). This is
+  used by the adaptive sampling of \ref QCPGraph, making each replot of a long graph cost O(pixels
+  log n) instead of O(n). The pyramid takes about two bytes of memory per data point and is
+  disabled by default.
+  
+  The pyramid is built on the first query after enabling, and afterwards only the parts changed by
+  \ref set, \ref add and the remove methods are rebuilt.
+  
+  \see invalidateMinMaxPyramid
+*/
+template <class DataType>
+void QCPDataContainer<DataType>::setMinMaxPyramid(bool enabled)
+{
+  if (mMinMaxPyramid == enabled)
+    return;
+  mMinMaxPyramid = enabled;
+  mPyramid.clear();
+  mPyramidDataSize = 0;
+  invalidateMinMaxPyramid();
+}
+
+/*!
+  Marks the whole min/max pyramid for rebuilding. Call this after changing values in-place
+  through the non-const iterators (\ref begin, \ref end), which the container can't track.
+  
+  \see setMinMaxPyramid
+*/
+template <class DataType>
+void QCPDataContainer<DataType>::invalidateMinMaxPyramid()
+{
+  mPyramidDirtyBegin = 0;
+  mPyramidDirtyEnd = (std::numeric_limits<int>::max)();
+}
+
+/*!
+  Returns the range spanned by the main values (see \ref qcpdatacontainer-datatype "DataType
+  requirements") of the data points from \a begin up to but not including \a end. Values which
+  are NaN are skipped. If there is no value, the returned range has a lower bound greater than its
+  upper bound.
+  
+  If the min/max pyramid is enabled (\ref setMinMaxPyramid), at most one partial block at either
+  end is scanned and the rest is taken from the pyramid, otherwise all points are scanned.
+*/
+template <class DataType>
+QCPRange QCPDataContainer<DataType>::mainValueRange(const_iterator begin, const_iterator end) const
+{
+  QCPRange range((std::numeric_limits<double>::infinity)(), -(std::numeric_limits<double>::infinity)());
+  if (!mMinMaxPyramid)
+  {
+    for (const_iterator it=begin; it!=end; ++it)
+    {
+      const double value = it->mainValue();
+      if (value < range.lower)
+        range.lower = value;
+      if (value > range.upper)
+        range.upper = value;
+    }
+    return range;
+  }
+  
+  updateMinMaxPyramid();
+  int first = begin-mData.constBegin();
+  int last = end-mData.constBegin();
+  // scan the points before the first and after the last full block:
+  while (first < last && first%pyramidBlockSize != 0)
+  {
+    const double value = mData.at(first++).mainValue();
+    if (value < range.lower)
+      range.lower = value;
+    if (value > range.upper)
+      range.upper = value;
+  }
+  while (last > first && last%pyramidBlockSize != 0)
+  {
+    const double value = mData.at(--last).mainValue();
+    if (value < range.lower)
+      range.lower = value;
+    if (value > range.upper)
+      range.upper = value;
+  }
+  // climb the pyramid, taking the unpaired block at either end of each level:
+  int blockBegin = first/pyramidBlockSize;
+  int blockEnd = last/pyramidBlockSize;
+  for (int level=0; blockBegin < blockEnd; ++level)
+  {
+    if (blockBegin & 1)
+    {
+      const QCPRange &block = mPyramid.at(level).at(blockBegin++);
+      range.lower = qMin(range.lower, block.lower);
+      range.upper = qMax(range.upper, block.upper);
+    }
+    if (blockEnd & 1)
+    {
+      const QCPRange &block = mPyramid.at(level).at(--blockEnd);
+      range.lower = qMin(range.lower, block.lower);
+      range.upper = qMax(range.upper, block.upper);
+    }
+    blockBegin >>= 1;
+    blockEnd >>= 1;
+  }
+  return range;
+}
+
+/*! \internal
+  
+  Records that the entries of mData from \a dataIndexBegin up to \a dataIndexEnd have changed, so
+  the min/max pyramid blocks covering them are rebuilt on the next query. Indices count from the
+  start of mData, including the preallocation pool, so removing points from the front (which only
+  grows the pool) leaves the pyramid valid.
+*/
+template <class DataType>
+void QCPDataContainer<DataType>::markPyramidDirty(int dataIndexBegin, int dataIndexEnd)
+{
+  if (!mMinMaxPyramid)
+    return;
+  if (mPyramidDirtyBegin >= mPyramidDirtyEnd) // nothing was dirty yet
+  {
+    mPyramidDirtyBegin = dataIndexBegin;
+    mPyramidDirtyEnd = dataIndexEnd;
+  } else
+  {
+    mPyramidDirtyBegin = qMin(mPyramidDirtyBegin, dataIndexBegin);
+    mPyramidDirtyEnd = qMax(mPyramidDirtyEnd, dataIndexEnd);
+  }
+}
+
+/*! \internal
+  
+  Rebuilds the blocks of the min/max pyramid which cover changed entries, and every block past the
+  smaller of the old and new size of mData if the size has changed. Each level is rebuilt from the
+  level below over the parents of the rebuilt blocks only.
+*/
+template <class DataType>
+void QCPDataContainer<DataType>::updateMinMaxPyramid() const
+{
+  const int dataSize = mData.size();
+  int dirtyBegin = mPyramidDirtyBegin;
+  int dirtyEnd = qMin(mPyramidDirtyEnd, dataSize);
+  if (dirtyBegin >= dirtyEnd)
+  {
+    dirtyBegin = dataSize;
+    dirtyEnd = 0;
+  }
+  if (dataSize != mPyramidDataSize || mPyramid.isEmpty())
+  {
+    dirtyBegin = qMin(dirtyBegin, qMin(dataSize, mPyramidDataSize));
+    if (mPyramid.isEmpty())
+      dirtyBegin = 0;
+    dirtyEnd = dataSize;
+  }
+  mPyramidDirtyBegin = 0;
+  mPyramidDirtyEnd = 0;
+  mPyramidDataSize = dataSize;
+  if (dataSize == 0)
+  {
+    mPyramid.clear();
+    return;
+  }
+  if (dirtyBegin >= dirtyEnd && !mPyramid.isEmpty())
+    return;
+  
+  // level 0 straight from the data:
+  int levelSize = (dataSize+pyramidBlockSize-1)/pyramidBlockSize;
+  int blockBegin = dirtyBegin/pyramidBlockSize;
+  int blockEnd = qMin(levelSize, (dirtyEnd+pyramidBlockSize-1)/pyramidBlockSize);
+  if (mPyramid.isEmpty())
+    mPyramid.resize(1);
+  mPyramid[0].resize(levelSize);
+  for (int block=blockBegin; block<blockEnd; ++block)
+  {
+    QCPRange range((std::numeric_limits<double>::infinity)(), -(std::numeric_limits<double>::infinity)());
+    const int pointEnd = qMin(dataSize, (block+1)*pyramidBlockSize);
+    for (int point=block*pyramidBlockSize; point<pointEnd; ++point)
+    {
+      const double value = mData.at(point).mainValue();
+      if (value < range.lower)
+        range.lower = value;
+      if (value > range.upper)
+        range.upper = value;
+    }
+    mPyramid[0][block] = range;
+  }
+  
+  // higher levels from the level below, until a level has a single block:
+  int level = 0;
+  while (levelSize > 1)
+  {
+    const int childSize = levelSize;
+    levelSize = (levelSize+1)/2;
+    blockBegin /= 2;
+    blockEnd = qMin(levelSize, (blockEnd+1)/2);
+    ++level;
+    if (mPyramid.size() <= level)
+      mPyramid.resize(level+1);
+    mPyramid[level].resize(levelSize);
+    const QVector<QCPRange> &children = mPyramid.at(level-1);
+    for (int block=blockBegin; block<blockEnd; ++block)
+    {
+      QCPRange range = children.at(2*block);
+      if (2*block+1 < childSize)
+      {
+        range.lower = qMin(range.lower, children.at(2*block+1).lower);
+        range.upper = qMax(range.upper, children.at(2*block+1).upper);
+      }
+      mPyramid[level][block] = range;
+    }
+  }
+  mPyramid.resize(level+1);
+}
 /* end of 'src/datacontainer.cpp' */
 
 
@@ -5169,6 +5433,7 @@ class QCP_LIB_DECL QCPGraph : public QCPAbstractPlottable1D<QCPGraphData>
   Q_PROPERTY(int scatterSkip READ scatterSkip WRITE setScatterSkip)
   Q_PROPERTY(QCPGraph* channelFillGraph READ channelFillGraph WRITE setChannelFillGraph)
   Q_PROPERTY(bool adaptiveSampling READ adaptiveSampling WRITE setAdaptiveSampling)
+  Q_PROPERTY(bool scatterStamping READ scatterStamping WRITE setScatterStamping)
   /// \endcond
 public:
   /*!
@@ -5196,6 +5461,7 @@ public:
   int scatterSkip() const { return mScatterSkip; }
   QCPGraph *channelFillGraph() const { return mChannelFillGraph.data(); }
   bool adaptiveSampling() const { return mAdaptiveSampling; }
+  bool scatterStamping() const { return mScatterStamping; }
   
   // setters:
   void setData(QSharedPointer<QCPGraphDataContainer> data);
@@ -5205,6 +5471,7 @@ public:
   void setScatterSkip(int skip);
   void setChannelFillGraph(QCPGraph *targetGraph);
   void setAdaptiveSampling(bool enabled);
+  void setScatterStamping(bool enabled);
   
   // non-property methods:
   void addData(const QVector<double> &keys, const QVector<double> &values, bool alreadySorted=false);
@@ -5222,6 +5489,19 @@ protected:
   int mScatterSkip;
   QPointer<QCPGraph> mChannelFillGraph;
   bool mAdaptiveSampling;
+  bool mScatterStamping;
+  
+  // non-property members:
+  struct ScatterStamp
+  {
+    QCPScatterStyle style;
+    QPen pen;
+    bool antialiased;
+    double devicePixelRatio;
+    int radius;
+    QPixmap pixmap;
+  };
+  mutable QList<ScatterStamp> mScatterStamps;
   
   // reimplemented virtual methods:
   virtual void draw(QCPPainter *painter) Q_DECL_OVERRIDE;
@@ -5245,6 +5525,8 @@ protected:
   QVector<QPointF> dataToStepRightLines(const QVector<QCPGraphData> &data) const;
   QVector<QPointF> dataToStepCenterLines(const QVector<QCPGraphData> &data) const;
   QVector<QPointF> dataToImpulseLines(const QVector<QCPGraphData> &data) const;
+  const ScatterStamp &getScatterStamp(const QCPScatterStyle &style, bool antialiased) const;
+  void drawStampedScatters(QCPPainter *painter, const QVector<QPointF> &scatters, const QCPScatterStyle &style) const;
   QVector<QCPDataRange> getNonNanSegments(const QVector<QPointF> *lineData, Qt::Orientation keyOrientation) const;
   QVector<QPair<QCPDataRange, QCPDataRange> > getOverlappingSegments(QVector<QCPDataRange> thisSegments, const QVector<QPointF> *thisData, QVector<QCPDataRange> otherSegments, const QVector<QPointF> *otherData) const;
   bool segmentsIntersect(double aLower, double aUpper, double bLower, double bUpper, int &bPrecedence) const;
@@ -5738,8 +6020,13 @@ protected:
   unsigned char *mAlpha;
   QCPRange mDataBounds;
   bool mDataModified;
+  QVector<int> mDirtyKeyLower, mDirtyKeyUpper; // per value index, the span of key indices changed since the last image update (lower > upper if clean)
+  QVector<int> mDirtyValueLower, mDirtyValueUpper; // per key index, the span of value indices changed since the last image update
+  bool mCellsDirty;
   
   bool createAlpha(bool initializeOpaque=true);
+  void markCellDirty(int keyIndex, int valueIndex);
+  void clearDirtyCells();
   
   friend class QCPColorMap;
 };
@@ -0,0 +1,118 @@
+#include "segrechart.h"
+#include <algorithm>
+#include <cmath>
+
+static const char *const chartQuantityNames_[numberOfChartQuantities] = {
+    "Binding Energy per Nucleon / keV",
+    "Mass Excess / MeV",
+    "Neutron Separation Energy / MeV",
+    "Proton Separation Energy / MeV",
+    "Atomic Mass Uncertainty / keV",
+    "Experimental - Liquid Drop Binding Energy / MeV"
+};
+
+/* constructor - nothing is drawn until a table is set */
+SegreChart::SegreChart(QCustomPlot *plot)
+    : plot_(plot)
+    , map_(nullptr)
+    , scale_(nullptr)
+    , table_(nullptr)
+{
+}
+
+/* the colour map and its scale are made once and reused for every table and quantity */
+void SegreChart::createMap()
+{
+    QCustomPlot *plot = this->plot_;
+    plot->setInteraction(QCP::iRangeDrag, true);
+    plot->setInteraction(QCP::iRangeZoom, true);
+    plot->xAxis->setLabel("Neutron Number (N)");
+    plot->yAxis->setLabel("Proton Number (Z)");
+
+    this->map_ = new QCPColorMap(plot->xAxis, plot->yAxis);
+    this->map_->setInterpolate(false);
+    this->map_->setTightBoundary(false);
+
+    this->scale_ = new QCPColorScale(plot);
+    plot->plotLayout()->addElement(0, 1, this->scale_);
+    this->scale_->setType(QCPAxis::atRight);
+    this->map_->setColorScale(this->scale_);
+
+    /* keep the colour scale level with the axis rect */
+    QCPMarginGroup *marginGroup = new QCPMarginGroup(plot);
+    plot->axisRect()->setMarginGroup(QCP::msBottom | QCP::msTop, marginGroup);
+    this->scale_->setMarginGroup(QCP::msBottom | QCP::msTop, marginGroup);
+}
+
+/* size the grid so cell (N, Z) sits at key N and value Z */
+void SegreChart::setTable(const NuclideTable *table)
+{
+    if (this->map_ == nullptr) this->createMap();
+    this->table_ = table;
+    QCPColorMapData *data = this->map_->data();
+    if (table == nullptr || table->empty()) {
+        data->clear();
+        return;
+    }
+
+    const ColumnSpan<std::int16_t> neutrons = table->neutrons();
+    const ColumnSpan<std::int16_t> protons = table->protons();
+    const int maximumNeutrons = *std::max_element(neutrons.begin(), neutrons.end());
+    const int maximumProtons = *std::max_element(protons.begin(), protons.end());
+
+    data->setSize(maximumNeutrons + 1, maximumProtons + 1);
+    data->setRange(QCPRange(0, maximumNeutrons), QCPRange(0, maximumProtons));
+    data->fill(0);
+    data->fillAlpha(0);
+
+    this->plot_->xAxis->setRange(-0.5, maximumNeutrons + 0.5);
+    this->plot_->yAxis->setRange(-0.5, maximumProtons + 0.5);
+}
+
+/* write one value per row into its cell - only the cell values and alphas change, plus the data range and gradient when
+   they differ from the last quantity */
+void SegreChart::setValues(const double *values, const QString &label, bool diverging)
+{
+    if (this->map_ == nullptr || this->table_ == nullptr) return;
+    const NuclideTable &table = *this->table_;
+    const ColumnSpan<std::int16_t> neutrons = table.neutrons();
+    const ColumnSpan<std::int16_t> protons = table.protons();
+    QCPColorMapData *data = this->map_->data();
+
+    double minimum = INFINITY;
+    double maximum = -INFINITY;
+    for (int row = 0; row < table.size(); row++) {
+        const double value = values[row];
+        if (std::isfinite(value)) {
+            data->setCell(neutrons[row], protons[row], value);
+            data->setAlpha(neutrons[row], protons[row], 255);
+            minimum = std::min(minimum, value);
+            maximum = std::max(maximum, value);
+        } else {
+            data->setAlpha(neutrons[row], protons[row], 0);
+        }
+    }
+
+    if (minimum <= maximum) {
+        if (diverging) {
+            const double limit = std::max(std::fabs(minimum), std::fabs(maximum));
+            minimum = -limit;
+            maximum = limit;
+        }
+        if (minimum == maximum) maximum = minimum + 1;
+
+        /* a new range or gradient recolours every cell, so leave them alone when only some cells changed */
+        const QCPRange range(minimum, maximum);
+        if (range != this->map_->dataRange()) this->map_->setDataRange(range);
+    }
+    const QCPColorGradient gradient(diverging ? QCPColorGradient::gpPolar : QCPColorGradient::gpJet);
+    if (gradient != this->map_->gradient()) this->map_->setGradient(gradient);
+    this->scale_->axis()->setLabel(label);
+}
+
+/* returns the name of a quantity */
+const char *SegreChart::quantityName(ChartQuantity quantity)
+{
+    if (quantity < 0 || quantity >= numberOfChartQuantities) return "";
+    return chartQuantityNames_[quantity];
+}
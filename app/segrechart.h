@@ -0,0 +1,49 @@
+#ifndef SEGRECHART_H
+#define SEGRECHART_H
+
+#include <QString>
+#include "nuclidetable.h"
+#include "qcustomplot.h"
+
+/* quantities the chart of nuclides can be coloured by */
+enum ChartQuantity
+{
+    ChartBindingEnergy,         // binding energy per nucleon, keV
+    ChartMassExcess,            // mass excess, MeV
+    ChartNeutronSeparation,     // S_n, MeV
+    ChartProtonSeparation,      // S_p, MeV
+    ChartMassUncertainty,       // atomic mass uncertainty, keV
+    ChartSemfResidual,          // experimental minus liquid drop binding energy, MeV
+    numberOfChartQuantities
+};
+
+/*
+ * Chart of nuclides (N across, Z up) drawn as a colour map with one cell per (N, Z). The colour
+ * map, its colour scale and the grid are made once per table in setTable(). Showing another
+ * quantity only writes new cell values and alphas into the existing grid, so the plottable is
+ * never rebuilt. Cells without a nuclide, or whose value is NaN, are transparent.
+ */
+class SegreChart
+{
+private:
+    QCustomPlot *plot_;
+    QCPColorMap *map_;
+    QCPColorScale *scale_;
+    const NuclideTable *table_;
+
+    /* create the colour map and colour scale the first time a table is shown */
+    void createMap();
+
+public:
+    explicit SegreChart(QCustomPlot *plot);
+
+    /* size the grid to the table - every cell starts transparent */
+    void setTable(const NuclideTable *table);
+
+    /* colour the cells by one value per table row - diverging values get a range symmetric about zero */
+    void setValues(const double *values, const QString &label, bool diverging = false);
+
+    /* returns the name of a quantity */
+    static const char *quantityName(ChartQuantity quantity);
+};
+#endif // SEGRECHART_H
@@ -0,0 +1,14 @@
+# Console benchmarks for the bulk calculations, the colour map kernels and the uncertainty engine - build in release mode for meaningful timings
+
+TEMPLATE = app
+CONFIG += console c++17
+CONFIG -= app_bundle qt
+
+include(../core/core.pri)
+
+# the colorize kernels behind the colour map do not need Qt
+INCLUDEPATH += ../app
+
+SOURCES += \
+    main.cpp \
+    ../app/colorizekernel.cpp
@@ -0,0 +1,217 @@
+#include "atom.h"
+#include "bulkcalculator.h"
+#include "colorizekernel.h"
+#include "nuclideindex.h"
+#include "nuclidetable.h"
+#include "parallel.h"
+#include "uncertainty.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+/* build a table shaped like the AME chart - roughly 3400 nuclides along the valley of stability, after the neutron */
+static void buildTable(NuclideTable &table)
+{
+    NuclideRecord record;
+    std::memset(&record, 0, sizeof(record));
+    record.neutrons = 1;
+    record.nucleons = 1;
+    std::strcpy(record.element, "n");
+    record.atomicMass = 1008664.91582;
+    record.atomicMassUncertainty = 0.00049;
+    table.append(record);
+    for (int protons = 1; protons <= 118; protons++) {
+        const int centre = static_cast<int>(protons * (1.0 + 0.0065 * protons));
+        for (int neutrons = centre - 14; neutrons <= centre + 14; neutrons++) {
+            if (neutrons < 0) continue;
+            record.protons = protons;
+            record.neutrons = neutrons;
+            record.nucleons = protons + neutrons;
+            std::strcpy(record.element, elementSymbol(protons));
+            record.atomicMass = record.nucleons * 1.0e6 + (neutrons - centre) * 1234.5678 - protons * 87.654321;
+            record.atomicMassUncertainty = 0.5 + neutrons * 0.01;
+            table.append(record);
+        }
+    }
+}
+
+/* time a function over a number of repetitions and return nanoseconds per nuclide */
+template <typename Function>
+static double timePerNuclide(int repetitions, int nuclides, Function function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repetitions; r++) function();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / (static_cast<double>(repetitions) * nuclides);
+}
+
+/* compare the scalar Atom function and the bulk kernel for one quantity */
+template <typename Scalar, typename Bulk>
+static void benchmark(const char *name, const NuclideTable &table, Scalar scalar, Bulk bulk)
+{
+    const int repetitions = 2000;
+    const int count = table.size();
+    std::vector<double> scalarResult(count), bulkResult(count);
+
+    /* scalar path - one Atom per row as the calculator uses it */
+    std::vector<Atom> atoms;
+    atoms.reserve(count);
+    for (int row = 0; row < count; row++) atoms.push_back(table.atom(row));
+    double scalarTime = timePerNuclide(repetitions, count, [&]() {
+        for (int row = 0; row < count; row++) scalarResult[row] = scalar(atoms[row]);
+    });
+
+    /* bulk path */
+    double bulkTime = timePerNuclide(repetitions, count, [&]() { bulk(table, bulkResult.data()); });
+
+    /* count results which differ from the scalar path */
+    int mismatches = 0;
+    for (int row = 0; row < count; row++) {
+        if (std::memcmp(&scalarResult[row], &bulkResult[row], sizeof(double)) != 0) mismatches++;
+    }
+
+    std::printf("%-32s scalar %7.2f ns  bulk %7.2f ns  speedup %5.1fx  mismatches %d\n",
+                name, scalarTime, bulkTime, scalarTime / bulkTime, mismatches);
+}
+
+/* compare every quantity for one set of constants */
+template <typename Constants>
+static void benchmarkConstants(const char *name, const NuclideTable &table)
+{
+    std::printf("\n%s constants\n", name);
+    benchmark("calcNuclearMass", table,
+              [](const Atom &atom) { return atom.calcNuclearMass<Constants>(); },
+              [](const NuclideTable &nuclides, double *out) { BulkCalculator::calcNuclearMass<Constants>(nuclides, out); });
+    benchmark("calcNuclearMass (Lunney)", table,
+              [](const Atom &atom) { return atom.calcNuclearMass<Constants>(ElectronBindingLunney); },
+              [](const NuclideTable &nuclides, double *out) { BulkCalculator::calcNuclearMass<Constants>(nuclides, out, ElectronBindingLunney); });
+    benchmark("calcMassDefectamu", table, std::mem_fn(&Atom::calcMassDefectamu<Constants>), &BulkCalculator::calcMassDefectamu<Constants>);
+    benchmark("calcMassDefectkg", table, std::mem_fn(&Atom::calcMassDefectkg<Constants>), &BulkCalculator::calcMassDefectkg<Constants>);
+    benchmark("calcBindingEnergyJ", table, std::mem_fn(&Atom::calcBindingEnergyJ<Constants>), &BulkCalculator::calcBindingEnergyJ<Constants>);
+    benchmark("calcBindingEnergykeV", table, std::mem_fn(&Atom::calcBindingEnergykeV<Constants>), &BulkCalculator::calcBindingEnergykeV<Constants>);
+    benchmark("calcBindingEnergyperNucleonkeV", table, std::mem_fn(&Atom::calcBindingEnergyperNucleonkeV<Constants>), &BulkCalculator::calcBindingEnergyperNucleonkeV<Constants>);
+}
+
+/* the scalar loops of QCPColorGradient::colorize before it used the colorize kernels */
+static void colorizeReference(const double *data, const unsigned char *alpha, double lower, double upper, bool logarithmic,
+                              const std::vector<std::uint32_t> &colors, std::uint32_t *scanLine, int n)
+{
+    const int levelCount = static_cast<int>(colors.size());
+    const double posToIndexFactor = (levelCount - 1) / (upper - lower);
+    for (int i = 0; i < n; ++i) {
+        int index = logarithmic ? std::log(data[i] / lower) / std::log(upper / lower) * (levelCount - 1)
+                                : (data[i] - lower) * posToIndexFactor;
+        if (index < 0) index = 0;
+        else if (index >= levelCount) index = levelCount - 1;
+        if (alpha == nullptr || alpha[i] == 255) {
+            scanLine[i] = colors[index];
+        } else {
+            const std::uint32_t rgb = colors[index];
+            const float alphaF = alpha[i] / 255.0f;
+            scanLine[i] = (static_cast<std::uint32_t>(static_cast<int>(((rgb >> 24) & 0xff) * alphaF) & 0xff) << 24)
+                        | (static_cast<std::uint32_t>(static_cast<int>(((rgb >> 16) & 0xff) * alphaF) & 0xff) << 16)
+                        | (static_cast<std::uint32_t>(static_cast<int>(((rgb >> 8) & 0xff) * alphaF) & 0xff) << 8)
+                        | static_cast<std::uint32_t>(static_cast<int>((rgb & 0xff) * alphaF) & 0xff);
+        }
+    }
+}
+
+/* time the old loop against the colorize kernels on a square map, one scanline at a time as updateMapImage does */
+static void benchmarkColorize(const char *name, int size, bool logarithmic, bool withAlpha)
+{
+    const int cells = size * size;
+    std::vector<double> data(cells);
+    std::vector<unsigned char> alpha(cells);
+    for (int i = 0; i < cells; i++) {
+        const double x = (i % size) / static_cast<double>(size);
+        const double y = (i / size) / static_cast<double>(size);
+        data[i] = 1.0 + 999.0 * (0.5 + 0.5 * std::sin(12.0 * x) * std::cos(7.0 * y));
+        alpha[i] = (i % 7 == 0) ? 0 : ((i % 5 == 0) ? static_cast<unsigned char>(i % 256) : 255);
+    }
+
+    /* a 350 level table like QCPColorGradient's default */
+    std::vector<std::uint32_t> colors(350);
+    for (int level = 0; level < 350; level++) colors[level] = 0xff000000u | (level * 0x00010307u & 0x00ffffffu);
+    const double lower = 1.0;
+    const double upper = 1000.0;
+
+    std::vector<std::uint32_t> reference(cells), result(cells);
+    const unsigned char *alphaData = withAlpha ? alpha.data() : nullptr;
+    const int repetitions = size <= 1024 ? 20 : 3;
+    const double referenceTime = timePerNuclide(repetitions, cells, [&]() {
+        for (int line = 0; line < size; line++)
+            colorizeReference(data.data() + line * size, alphaData ? alphaData + line * size : nullptr, lower, upper, logarithmic,
+                              colors, reference.data() + line * size, size);
+    });
+    const double kernelTime = timePerNuclide(repetitions, cells, [&]() {
+        for (int line = 0; line < size; line++) {
+            if (logarithmic) colorizeLogarithmic(data.data() + line * size, 1, size, lower, std::log(upper / lower), colors.data(), 350, result.data() + line * size);
+            else colorizeLinear(data.data() + line * size, 1, size, lower, 349 / (upper - lower), colors.data(), 350, result.data() + line * size);
+            if (withAlpha) colorizeApplyAlpha(alpha.data() + line * size, 1, size, result.data() + line * size);
+        }
+    });
+
+    int mismatches = 0;
+    for (int i = 0; i < cells; i++) {
+        if (reference[i] != result[i]) mismatches++;
+    }
+    std::printf("%-32s loop %7.2f ns  %-6s %7.2f ns  speedup %5.1fx  mismatches %d\n",
+                name, referenceTime, colorizeInstructionSet(), kernelTime, referenceTime / kernelTime, mismatches);
+}
+
+/* time Monte Carlo propagation of S_n over the whole table on one thread and on every core - the results must agree bit for bit */
+static void benchmarkMonteCarlo(const NuclideTable &table, int samples)
+{
+    NuclideIndex index;
+    index.build(table);
+    const DerivedQuantity quantity = DerivedQuantity::separationEnergy<AccurateConstants>(table, index, SeparationNeutron);
+    const int count = table.size();
+    const unsigned threads = std::max(parallelThreadCount(), 4u);     // at least four, so the comparison means something on a small machine
+    std::vector<double> means(count), deviations(count), parallelMeans(count), parallelDeviations(count);
+
+    const auto start = std::chrono::steady_clock::now();
+    UncertaintyPropagator::monteCarlo(table, quantity, samples, 1, means.data(), deviations.data(), 1);
+    const auto middle = std::chrono::steady_clock::now();
+    UncertaintyPropagator::monteCarlo(table, quantity, samples, 1, parallelMeans.data(), parallelDeviations.data(), threads);
+    const auto stop = std::chrono::steady_clock::now();
+
+    int mismatches = 0;
+    for (int row = 0; row < count; row++) {
+        if (std::memcmp(&means[row], &parallelMeans[row], sizeof(double)) != 0
+                || std::memcmp(&deviations[row], &parallelDeviations[row], sizeof(double)) != 0) mismatches++;
+    }
+    const double serialTime = std::chrono::duration<double>(middle - start).count();
+    const double parallelTime = std::chrono::duration<double>(stop - middle).count();
+    std::printf("%-32s 1 thread %6.2f s  %u threads %6.2f s  speedup %5.1fx  mismatches %d\n",
+                "Monte Carlo Sn", serialTime, threads, parallelTime, serialTime / parallelTime, mismatches);
+}
+
+int main()
+{
+    NuclideTable table;
+    buildTable(table);
+    std::printf("%d nuclides\n", table.size());
+
+    benchmarkConstants<AccurateConstants>("accurate", table);
+    benchmarkConstants<ALevelConstants>("a-level", table);
+
+    std::printf("\ncolour map colorize, per cell\n");
+    for (int size : {1024, 4096}) {
+        char name[64];
+        std::snprintf(name, sizeof(name), "linear %dx%d", size, size);
+        benchmarkColorize(name, size, false, false);
+        std::snprintf(name, sizeof(name), "logarithmic %dx%d", size, size);
+        benchmarkColorize(name, size, true, false);
+        std::snprintf(name, sizeof(name), "linear with alpha %dx%d", size, size);
+        benchmarkColorize(name, size, false, true);
+    }
+
+    std::printf("\nuncertainty propagation, 100000 samples over the table\n");
+    benchmarkMonteCarlo(table, 100000);
+    return 0;
+}
@@ -0,0 +1,280 @@
+#include "batchprocessor.h"
+#include "bulkcalculator.h"
+#include "uncertainty.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+/* names of the decay Q-value columns */
+static const char *const decayColumnNames_[numberOfDecayModes] = {
+    "Qalpha", "QbetaMinus", "QbetaPlus", "QEC"
+};
+
+/* append a number, or an empty csv field / JSON null if it is not available */
+static void appendNumber(std::string &out, double value, BatchFormat format)
+{
+    if (std::isnan(value)) {
+        if (format == BatchJson) out += "null";
+        return;
+    }
+    char buffer[32];
+    const int length = std::snprintf(buffer, sizeof(buffer), "%.12g", value);
+    out.append(buffer, static_cast<std::size_t>(length));
+}
+
+static void appendInteger(std::string &out, int value)
+{
+    char buffer[16];
+    const int length = std::snprintf(buffer, sizeof(buffer), "%d", value);
+    out.append(buffer, static_cast<std::size_t>(length));
+}
+
+/* append a string - quoted for JSON, where the only characters which could need escaping are quotes and backslashes */
+static void appendString(std::string &out, const std::string &value, BatchFormat format)
+{
+    if (format == BatchCsv) {
+        /* reactions hold a comma so they are always quoted */
+        if (value.find(',') != std::string::npos) out += '"' + value + '"';
+        else out += value;
+        return;
+    }
+    out += '"';
+    for (char c : value) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    out += '"';
+}
+
+/* append the separator and, for JSON, the key of the next field */
+static void appendField(std::string &out, const char *name, bool first, BatchFormat format)
+{
+    if (!first) out += ',';
+    if (format == BatchJson) {
+        out += '"';
+        out += name;
+        out += "\":";
+    }
+}
+
+/* constructor - compute the whole-table quantities once */
+BatchProcessor::BatchProcessor(const NuclideTable &table, const NuclideIndex &index, BatchFormat format, bool useAccurate, int monteCarloSamples)
+    : table_(table)
+    , index_(index)
+    , qValueCalculator_(table, index)
+    , format_(format)
+    , useAccurate_(useAccurate)
+    , monteCarloSamples_(monteCarloSamples)
+{
+    if (useAccurate) this->prepare<AccurateConstants>();
+    else this->prepare<ALevelConstants>();
+}
+
+/* mass defects, separation energies and decay Q-values of every nuclide */
+template <typename Constants>
+void BatchProcessor::prepare()
+{
+    const std::size_t count = static_cast<std::size_t>(this->table_.size());
+    this->massDefect_.resize(count);
+    BulkCalculator::calcMassDefectamu<Constants>(this->table_, this->massDefect_.data());
+    this->separationEnergies_.compute<Constants>(this->table_, this->index_);
+    for (int channel = 0; channel < numberOfSeparationChannels; channel++) {
+        const SeparationChannel separation = static_cast<SeparationChannel>(channel);
+        const ColumnSpan<double> uncertainty = this->separationEnergies_.uncertainty(separation);
+        this->separationUncertainties_[channel].assign(uncertainty.begin(), uncertainty.end());
+        if (this->monteCarloSamples_ > 0) {
+            const DerivedQuantity quantity = DerivedQuantity::separationEnergy<Constants>(this->table_, this->index_, separation);
+            std::vector<double> means(count);
+            UncertaintyPropagator::monteCarlo(this->table_, quantity, this->monteCarloSamples_, monteCarloSeed_,
+                                              means.data(), this->separationUncertainties_[channel].data());
+        }
+    }
+    for (int mode = 0; mode < numberOfDecayModes; mode++) {
+        this->decayQValues_[mode].resize(count);
+        this->decayUncertainties_[mode].resize(count);
+        this->qValueCalculator_.chart<Constants>(static_cast<DecayMode>(mode), this->decayQValues_[mode].data(), this->decayUncertainties_[mode].data());
+    }
+}
+
+/* Q-values of the reactions in a batch */
+template <typename Constants>
+void BatchProcessor::reactionQValues(const std::vector<Query> &queries, std::vector<double> &qValues, std::vector<double> &uncertainties) const
+{
+    std::vector<Reaction> reactions(queries.size());
+    std::vector<int> protons(queries.size()), nucleons(queries.size());
+    for (std::size_t i = 0; i < queries.size(); i++) {
+        /* queries without a reaction ask for a nuclide which is never found */
+        reactions[i] = queries[i].reaction;
+        protons[i] = queries[i].valid && queries[i].hasReaction ? queries[i].protons : -1;
+        nucleons[i] = queries[i].nucleons;
+    }
+    qValues.resize(queries.size());
+    uncertainties.resize(queries.size());
+    this->qValueCalculator_.list<Constants>(reactions.data(), protons.data(), nucleons.data(), queries.size(), qValues.data(), uncertainties.data());
+}
+
+/* parse "Z A", "Z,A" or "Z A (x,y)" */
+bool BatchProcessor::parseQuery(const std::string &line, Query &query)
+{
+    const char *position = line.c_str();
+    char *end;
+    query.valid = false;
+    query.hasReaction = false;
+    query.reaction = Reaction{{0, 0}, {0, 0}, 0};
+    query.reactionText.clear();
+
+    query.protons = static_cast<int>(std::strtol(position, &end, 10));
+    if (end == position) return false;
+    position = end;
+    while (*position == ' ' || *position == '\t' || *position == ',' || *position == ';') position++;
+    query.nucleons = static_cast<int>(std::strtol(position, &end, 10));
+    if (end == position) return false;
+    position = end;
+
+    /* anything left is a reaction */
+    while (*position == ' ' || *position == '\t' || *position == ',' || *position == ';') position++;
+    const char *last = line.c_str() + line.size();
+    while (last > position && (*(last - 1) == ' ' || *(last - 1) == '\t' || *(last - 1) == '\r')) last--;
+    if (last > position) {
+        query.reactionText.assign(position, last);
+        if (!Reaction::parse(query.reactionText.c_str(), query.reaction)) return false;
+        query.hasReaction = true;
+    }
+    query.valid = true;
+    return true;
+}
+
+/* csv header naming every column */
+void BatchProcessor::writeHeader(std::string &out) const
+{
+    if (this->format_ != BatchCsv) return;
+    out += "Z,A,N,element,status,bindingEnergyPerNucleon,bindingEnergyPerNucleonUncertainty,atomicMass,atomicMassUncertainty,massDefect";
+    for (int channel = 0; channel < numberOfSeparationChannels; channel++) {
+        out += ',';
+        out += SeparationEnergies::channelName(static_cast<SeparationChannel>(channel));
+        out += ',';
+        out += SeparationEnergies::channelName(static_cast<SeparationChannel>(channel));
+        out += "Uncertainty";
+    }
+    for (int mode = 0; mode < numberOfDecayModes; mode++) {
+        out += ',';
+        out += decayColumnNames_[mode];
+        out += ',';
+        out += decayColumnNames_[mode];
+        out += "Uncertainty";
+    }
+    out += ",reaction,Q,QUncertainty,estimated,extrapolated\n";
+}
+
+/* one output line */
+void BatchProcessor::writeResult(std::string &out, const Query &query, double qValue, double qUncertainty) const
+{
+    const BatchFormat format = this->format_;
+    const int row = query.valid ? this->index_.find(query.protons, query.nucleons) : NuclideIndex::notFound;
+    const bool found = row != NuclideIndex::notFound;
+    const double notAvailable = std::nan("");
+
+    if (format == BatchJson) out += '{';
+    appendField(out, "Z", true, format);
+    if (query.valid) appendInteger(out, query.protons); else if (format == BatchJson) out += "null";
+    appendField(out, "A", false, format);
+    if (query.valid) appendInteger(out, query.nucleons); else if (format == BatchJson) out += "null";
+    appendField(out, "N", false, format);
+    if (query.valid) appendInteger(out, query.nucleons - query.protons); else if (format == BatchJson) out += "null";
+    appendField(out, "element", false, format);
+    appendString(out, found ? this->table_.element(row) : "", format);
+    appendField(out, "status", false, format);
+    appendString(out, !query.valid ? "bad query" : (found ? "ok" : "not found"), format);
+
+    appendField(out, "bindingEnergyPerNucleon", false, format);
+    appendNumber(out, found ? this->table_.bindingEnergy()[row] : notAvailable, format);
+    appendField(out, "bindingEnergyPerNucleonUncertainty", false, format);
+    appendNumber(out, found ? this->table_.bindingEnergyUncertainty()[row] : notAvailable, format);
+    appendField(out, "atomicMass", false, format);
+    appendNumber(out, found ? this->table_.atomicMass()[row] : notAvailable, format);
+    appendField(out, "atomicMassUncertainty", false, format);
+    appendNumber(out, found ? this->table_.atomicMassUncertainty()[row] : notAvailable, format);
+    appendField(out, "massDefect", false, format);
+    appendNumber(out, found ? this->massDefect_[row] : notAvailable, format);
+
+    for (int channel = 0; channel < numberOfSeparationChannels; channel++) {
+        const SeparationChannel separation = static_cast<SeparationChannel>(channel);
+        appendField(out, SeparationEnergies::channelName(separation), false, format);
+        appendNumber(out, found ? this->separationEnergies_.energy(separation)[row] : notAvailable, format);
+        const std::string uncertaintyName = std::string(SeparationEnergies::channelName(separation)) + "Uncertainty";
+        appendField(out, uncertaintyName.c_str(), false, format);
+        appendNumber(out, found ? this->separationUncertainties_[channel][row] : notAvailable, format);
+    }
+    for (int mode = 0; mode < numberOfDecayModes; mode++) {
+        appendField(out, decayColumnNames_[mode], false, format);
+        appendNumber(out, found ? this->decayQValues_[mode][row] : notAvailable, format);
+        const std::string uncertaintyName = std::string(decayColumnNames_[mode]) + "Uncertainty";
+        appendField(out, uncertaintyName.c_str(), false, format);
+        appendNumber(out, found ? this->decayUncertainties_[mode][row] : notAvailable, format);
+    }
+
+    appendField(out, "reaction", false, format);
+    if (query.hasReaction) appendString(out, query.reactionText, format); else if (format == BatchJson) out += "null";
+    appendField(out, "Q", false, format);
+    appendNumber(out, query.hasReaction ? qValue : notAvailable, format);
+    appendField(out, "QUncertainty", false, format);
+    appendNumber(out, query.hasReaction ? qUncertainty : notAvailable, format);
+
+    const std::uint8_t flags = found ? this->table_.flags()[row] : 0;
+    appendField(out, "estimated", false, format);
+    out += (flags & NuclideEstimated) ? "true" : "false";
+    appendField(out, "extrapolated", false, format);
+    out += (flags & NuclideExtrapolated) ? "true" : "false";
+    out += format == BatchJson ? "}\n" : "\n";
+}
+
+/* answer a batch of queries */
+void BatchProcessor::processBatch(const std::vector<Query> &queries, std::ostream &out) const
+{
+    std::vector<double> qValues, uncertainties;
+    if (this->useAccurate_) this->reactionQValues<AccurateConstants>(queries, qValues, uncertainties);
+    else this->reactionQValues<ALevelConstants>(queries, qValues, uncertainties);
+
+    std::string text;
+    text.reserve(queries.size() * 256);
+    for (std::size_t i = 0; i < queries.size(); i++) this->writeResult(text, queries[i], qValues[i], uncertainties[i]);
+    out.write(text.data(), static_cast<std::streamsize>(text.size()));
+}
+
+/* read queries until the stream ends */
+std::size_t BatchProcessor::run(std::istream &in, std::ostream &out)
+{
+    std::string header;
+    this->writeHeader(header);
+    out.write(header.data(), static_cast<std::streamsize>(header.size()));
+
+    std::vector<Query> queries;
+    queries.reserve(batchSize_);
+    std::size_t total = 0;
+    std::string line;
+    Query query;
+    while (std::getline(in, line)) {
+        /* skip blank and comment lines */
+        const std::size_t first = line.find_first_not_of(" \t\r");
+        if (first != std::string::npos && line[first] != '#') {
+            parseQuery(line.substr(first), query);
+            queries.push_back(query);
+        }
+
+        /* answer a full batch, or a partial one when no more input is waiting so an interactive session gets
+           its answers as it goes */
+        const bool waiting = in.rdbuf()->in_avail() > 0;
+        if (queries.size() == batchSize_ || (!waiting && !queries.empty())) {
+            this->processBatch(queries, out);
+            total += queries.size();
+            queries.clear();
+            if (!waiting) out.flush();
+        }
+    }
+    if (!queries.empty()) {
+        this->processBatch(queries, out);
+        total += queries.size();
+    }
+    out.flush();
+    return total;
+}
@@ -0,0 +1,85 @@
+#ifndef BATCHPROCESSOR_H
+#define BATCHPROCESSOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "nuclideindex.h"
+#include "nuclidetable.h"
+#include "qvalues.h"
+#include "separationenergies.h"
+
+/* output formats of the batch tool */
+enum BatchFormat
+{
+    BatchCsv,           // a header line and one comma separated line per query
+    BatchJson           // one JSON object per line (JSON lines)
+};
+
+/*
+ * Answers a stream of queries against a loaded nuclide table. Each line holds a proton number and
+ * a nucleon number, separated by spaces, tabs or a comma, optionally followed by a reaction such as
+ * (n,g). Blank lines and lines starting with '#' are skipped. Every query gives one output line with
+ * the nuclide properties, separation energies and decay Q-values with their uncertainties, plus the
+ * Q-value of the reaction if one was given. Decay Q-value uncertainties are propagated linearly, and
+ * separation energy uncertainties linearly or by Monte Carlo over the whole table if a number of
+ * samples is given. Whole-table quantities are computed once up front and queries are answered in
+ * batches, so reaction Q-values are evaluated in parallel. Values which are not available are left
+ * empty in csv and written as null in JSON.
+ */
+class BatchProcessor
+{
+private:
+    /* one parsed input line */
+    struct Query
+    {
+        int protons;
+        int nucleons;
+        bool valid;
+        bool hasReaction;
+        Reaction reaction;
+        std::string reactionText;
+    };
+
+    const NuclideTable &table_;
+    const NuclideIndex &index_;
+    QValueCalculator qValueCalculator_;
+    BatchFormat format_;
+    bool useAccurate_;
+    int monteCarloSamples_;
+
+    /* whole-table quantities */
+    SeparationEnergies separationEnergies_;
+    std::vector<double> separationUncertainties_[numberOfSeparationChannels];
+    std::vector<double> massDefect_;
+    std::vector<double> decayQValues_[numberOfDecayModes];
+    std::vector<double> decayUncertainties_[numberOfDecayModes];
+
+    /* queries answered together */
+    static constexpr std::size_t batchSize_ = 8192;
+
+    /* fixed so the Monte Carlo uncertainties are the same on every run */
+    static constexpr std::uint64_t monteCarloSeed_ = 1;
+
+    template <typename Constants> void prepare();
+    template <typename Constants> void reactionQValues(const std::vector<Query> &queries, std::vector<double> &qValues, std::vector<double> &uncertainties) const;
+
+    static bool parseQuery(const std::string &line, Query &query);
+    void writeHeader(std::string &out) const;
+    void writeResult(std::string &out, const Query &query, double qValue, double qUncertainty) const;
+    void processBatch(const std::vector<Query> &queries, std::ostream &out) const;
+
+public:
+    /* the index must be built for the table - the accurate or a-level constants are used for derived masses and Q-values,
+       and monteCarloSamples > 0 propagates the separation energy uncertainties by Monte Carlo */
+    BatchProcessor(const NuclideTable &table, const NuclideIndex &index, BatchFormat format, bool useAccurate = true, int monteCarloSamples = 0);
+
+    /* read queries until the stream ends and write one result per query - results are written a batch at a time, or as
+       soon as the input has nothing more waiting - returns the number of queries */
+    std::size_t run(std::istream &in, std::ostream &out);
+};
+
+#endif // BATCHPROCESSOR_H
@@ -0,0 +1,17 @@
+# Headless batch tool - answers nuclide and reaction queries without a gui
+
+QT = core network
+
+TEMPLATE = app
+TARGET = atomicdata-cli
+CONFIG += console c++17
+CONFIG -= app_bundle
+
+include(../core/core.pri)
+
+SOURCES += \
+    main.cpp \
+    batchprocessor.cpp
+
+HEADERS += \
+    batchprocessor.h
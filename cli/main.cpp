@@ -0,0 +1,82 @@
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QTimer>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include "batchprocessor.h"
+#include "garveykelson.h"
+#include "nuclideindex.h"
+#include "nuclideloader.h"
+
+/* headless batch tool - loads the nuclide table once and answers queries from stdin or a file */
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("atomicdata-cli");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Answer nuclide and reaction queries, one per line as \"Z A\" or \"Z A (x,y)\".");
+    parser.addHelpOption();
+    parser.addOption({{"f", "format"}, "Output format: csv or json (JSON lines).", "format", "csv"});
+    parser.addOption({{"a", "a-level"}, "Use the a-level constants instead of the accurate ones."});
+    parser.addOption({{"x", "extrapolate"}, "Add Garvey-Kelson predictions for nuclides missing from the table."});
+    parser.addOption({{"m", "monte-carlo"}, "Propagate the separation energy uncertainties by Monte Carlo with this many samples.", "samples", "0"});
+    parser.addPositionalArgument("file", "Query file - standard input if not given.");
+    parser.process(app);
+
+    const QString formatName = parser.value("format").toLower();
+    if (formatName != "csv" && formatName != "json") {
+        std::fprintf(stderr, "Unknown format %s\n", qPrintable(formatName));
+        return 2;
+    }
+    const BatchFormat format = formatName == "json" ? BatchJson : BatchCsv;
+
+    bool samplesValid = false;
+    const int monteCarloSamples = parser.value("monte-carlo").toInt(&samplesValid);
+    if (!samplesValid || monteCarloSamples < 0) {
+        std::fprintf(stderr, "Invalid number of Monte Carlo samples %s\n", qPrintable(parser.value("monte-carlo")));
+        return 2;
+    }
+
+    /* load the table on this thread - a download needs the event loop, the local files do not */
+    NuclideLoader loader;
+    bool loaded = false;
+    QObject::connect(&loader, &NuclideLoader::loaded, &app, [&](int) {
+        loaded = true;
+        app.quit();
+    });
+    QObject::connect(&loader, &NuclideLoader::failed, &app, [&](const QString &message) {
+        std::fprintf(stderr, "Could not load nuclear data: %s\n", qPrintable(message));
+        app.quit();
+    });
+    QTimer::singleShot(0, &loader, &NuclideLoader::load);
+    app.exec();
+    if (!loaded) return 1;
+
+    std::unique_ptr<NuclideTable> table = loader.takeTable();
+    if (parser.isSet("extrapolate")) {
+        std::unique_ptr<NuclideTable> extrapolated(new NuclideTable);
+        GarveyKelson garveyKelson;
+        garveyKelson.extrapolate(*table, *extrapolated);
+        table.swap(extrapolated);
+    }
+    NuclideIndex index;
+    index.build(*table);
+
+    /* answer the queries */
+    std::ios::sync_with_stdio(false);
+    BatchProcessor processor(*table, index, format, !parser.isSet("a-level"), monteCarloSamples);
+    const QStringList files = parser.positionalArguments();
+    if (files.isEmpty()) {
+        processor.run(std::cin, std::cout);
+    } else {
+        std::ifstream in(files.first().toLocal8Bit().constData());
+        if (!in) {
+            std::fprintf(stderr, "Could not open %s\n", qPrintable(files.first()));
+            return 1;
+        }
+        processor.run(in, std::cout);
+    }
+    return 0;
+}
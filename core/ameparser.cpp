@@ -0,0 +1,282 @@
+#include "ameparser.h"
+
+/* powers of ten which are exactly representable as doubles */
+static constexpr double exactPowersOfTen_[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/* largest integer mantissa that converts to a double without rounding */
+static constexpr unsigned long long maxExactMantissa_ = 1ULL << 53;
+
+/* collects the digits of one or more character ranges into an integer mantissa and a decimal exponent */
+struct DecimalAccumulator
+{
+    unsigned long long mantissa = 0;
+    int fractionDigits = 0;
+    int digits = 0;
+    int exponent = 0;
+    bool negative = false;
+    bool negativeExponent = false;
+    bool fraction = false;
+    bool inExponent = false;
+    bool estimated = false;
+
+    void feed(const char *begin, const char *end){
+        for (const char *c = begin; c < end; c++) {
+            if (this->inExponent) {
+                /* exponent written by the csv export, e.g. 5e-05 */
+                if (*c >= '0' && *c <= '9') this->exponent = this->exponent * 10 + (*c - '0');
+                else if (*c == '-') this->negativeExponent = true;
+                else if (*c == '#') this->estimated = true;     // marker the csv export appends to estimated values
+            } else if (*c >= '0' && *c <= '9') {
+                /* drop digits which no longer fit - only possible for fields much wider than AME uses */
+                if (this->mantissa < maxExactMantissa_ / 10) {
+                    this->mantissa = this->mantissa * 10 + static_cast<unsigned long long>(*c - '0');
+                    if (this->fraction) this->fractionDigits++;
+                } else if (!this->fraction) {
+                    this->fractionDigits--;
+                }
+                this->digits++;
+            } else if (*c == '.') {
+                this->fraction = true;
+            } else if (*c == '#') {
+                /* AME marks estimated values with '#' in place of the decimal point */
+                this->fraction = true;
+                this->estimated = true;
+            } else if (*c == '-') {
+                this->negative = true;
+            } else if (*c == 'e' || *c == 'E') {
+                this->inExponent = true;
+            }
+        }
+    }
+
+    /* mantissa / 10^n is a single correctly rounded division, so this matches strtod for every AME and csv field */
+    double value() const {
+        double result = static_cast<double>(this->mantissa);
+        int exponent = this->fractionDigits + (this->negativeExponent ? this->exponent : -this->exponent);
+        while (exponent > 22) { result /= exactPowersOfTen_[22]; exponent -= 22; }
+        while (exponent < -22) { result *= exactPowersOfTen_[22]; exponent += 22; }
+        if (exponent >= 0) result /= exactPowersOfTen_[exponent];
+        else result *= exactPowersOfTen_[-exponent];
+        return this->negative ? -result : result;
+    }
+};
+
+/* returns the pointer to a field in a line clipped to the line length */
+static inline void fieldRange(const char *line, std::size_t length, const AmeField &field, const char *&begin, const char *&end)
+{
+    std::size_t start = static_cast<std::size_t>(field.start);
+    std::size_t stop = start + static_cast<std::size_t>(field.width);
+    if (start > length) start = length;
+    if (stop > length) stop = length;
+    begin = line + start;
+    end = line + stop;
+}
+
+/* true if a field holds blanks followed by at least one digit and nothing else */
+bool AmeParser::isIntegerField(const char *begin, const char *end)
+{
+    while (begin < end && *begin == ' ') begin++;
+    while (end > begin && *(end - 1) == ' ') end--;
+    if (begin == end) return false;
+    for (const char *c = begin; c < end; c++) {
+        if (*c < '0' || *c > '9') return false;
+    }
+    return true;
+}
+
+/* true if a field holds a number parseDouble can read - digits with a sign, a decimal point or '#' and an exponent */
+bool AmeParser::isDecimalField(const char *begin, const char *end)
+{
+    while (begin < end && *begin == ' ') begin++;
+    while (end > begin && *(end - 1) == ' ') end--;
+    bool digits = false;
+    for (const char *c = begin; c < end; c++) {
+        if (*c >= '0' && *c <= '9') digits = true;
+        else if (*c != '.' && *c != '#' && *c != '-' && *c != '+' && *c != 'e' && *c != 'E') return false;
+    }
+    return digits;
+}
+
+/* mass16.txt - fortran format a1,i3,i5,i5,i5,1x,a3,a4,1x,f13.5,f11.5,f11.3,f9.3,1x,a2,f11.3,f9.3,1x,i3,1x,f12.5,f11.5 */
+AmeFormat AmeFormat::ame2016()
+{
+    AmeFormat format;
+    format.headerLines = 39;
+    format.neutrons = {4, 5};
+    format.protons = {9, 5};
+    format.nucleons = {14, 5};
+    format.element = {20, 3};
+    format.bindingEnergy = {53, 11};
+    format.bindingEnergyUncertainty = {64, 9};
+    format.atomicMassInteger = {96, 3};
+    format.atomicMassFraction = {100, 12};
+    format.atomicMassUncertainty = {112, 11};
+    return format;
+}
+
+/* mass_1.mas20.txt - fortran format a1,i3,i5,i5,i5,1x,a3,a4,1x,f14.6,f12.6,f13.5,1x,f10.5,1x,a2,f13.5,f11.5,1x,i3,1x,f13.6,f12.6 */
+AmeFormat AmeFormat::ame2020()
+{
+    AmeFormat format;
+    format.headerLines = 36;
+    format.neutrons = {4, 5};
+    format.protons = {9, 5};
+    format.nucleons = {14, 5};
+    format.element = {20, 3};
+    format.bindingEnergy = {54, 13};
+    format.bindingEnergyUncertainty = {68, 10};
+    format.atomicMassInteger = {106, 3};
+    format.atomicMassFraction = {110, 13};
+    format.atomicMassUncertainty = {123, 12};
+    return format;
+}
+
+/* constructor which sets the column layout */
+AmeParser::AmeParser(const AmeFormat &format)
+    : format_(format)
+{
+}
+
+/* returns the shortest line length that holds every field */
+int AmeParser::minimumLineLength() const
+{
+    return this->format_.atomicMassUncertainty.start + 1;
+}
+
+/* returns an upper bound on the number of nuclides in a buffer */
+std::size_t AmeParser::countDataLines(const char *data, std::size_t size) const
+{
+    const std::size_t lines = countLines(data, size);
+    const std::size_t header = static_cast<std::size_t>(this->format_.headerLines);
+    return lines > header ? lines - header : 0;
+}
+
+/* returns an upper bound on the number of nuclides in a table of the given size in bytes */
+std::size_t AmeParser::estimateDataLines(std::size_t bytes) const
+{
+    return bytes / static_cast<std::size_t>(this->minimumLineLength());
+}
+
+/* returns the number of lines in a buffer */
+std::size_t AmeParser::countLines(const char *data, std::size_t size)
+{
+    std::size_t lines = 0;
+    const char *position = data;
+    const char *end = data + size;
+    while (position < end) {
+        const char *newline = static_cast<const char *>(std::memchr(position, '\n', end - position));
+        lines++;
+        position = newline ? newline + 1 : end;
+    }
+    return lines;
+}
+
+/* parse a single data line into a record */
+bool AmeParser::parseLine(const char *line, std::size_t length, NuclideRecord &record) const
+{
+    /* strip a carriage return left by windows line endings */
+    if (length > 0 && line[length - 1] == '\r') length--;
+
+    /* skip blank or truncated lines */
+    if (length < static_cast<std::size_t>(this->minimumLineLength())) return false;
+
+    const char *begin;
+    const char *end;
+    const char *begin2;
+    const char *end2;
+    bool estimated = false;
+    bool fieldEstimated;
+
+    /* get the number of neutrons, protons and nucleons */
+    fieldRange(line, length, this->format_.neutrons, begin, end);
+    if (!isIntegerField(begin, end)) return false;
+    record.neutrons = parseInt(begin, end);
+
+    fieldRange(line, length, this->format_.protons, begin, end);
+    if (!isIntegerField(begin, end)) return false;
+    record.protons = parseInt(begin, end);
+
+    fieldRange(line, length, this->format_.nucleons, begin, end);
+    if (!isIntegerField(begin, end)) return false;
+    record.nucleons = parseInt(begin, end);
+
+    /* get the element name */
+    fieldRange(line, length, this->format_.element, begin, end);
+    int symbolLength = 0;
+    for (const char *c = begin; c < end && symbolLength < 3; c++) {
+        if (*c != ' ') record.element[symbolLength++] = *c;
+    }
+    record.element[symbolLength] = '\0';
+
+    /* get the binding energy and its uncertainty */
+    fieldRange(line, length, this->format_.bindingEnergy, begin, end);
+    record.bindingEnergy = parseDouble(begin, end, fieldEstimated);
+    estimated = estimated || fieldEstimated;
+
+    fieldRange(line, length, this->format_.bindingEnergyUncertainty, begin, end);
+    record.bindingEnergyUncertainty = parseDouble(begin, end, fieldEstimated);
+    estimated = estimated || fieldEstimated;
+
+    /* get the atomic mass - the integer and fractional micro-u parts are split over two fields */
+    fieldRange(line, length, this->format_.atomicMassInteger, begin, end);
+    fieldRange(line, length, this->format_.atomicMassFraction, begin2, end2);
+    record.atomicMass = parseDouble(begin, end, begin2, end2, fieldEstimated);
+    estimated = estimated || fieldEstimated;
+
+    fieldRange(line, length, this->format_.atomicMassUncertainty, begin, end);
+    record.atomicMassUncertainty = parseDouble(begin, end, fieldEstimated);
+    estimated = estimated || fieldEstimated;
+
+    record.estimated = estimated;
+    return true;
+}
+
+/* convert a fixed width integer field */
+int AmeParser::parseInt(const char *begin, const char *end)
+{
+    int value = 0;
+    bool negative = false;
+    for (const char *c = begin; c < end; c++) {
+        if (*c >= '0' && *c <= '9') value = value * 10 + (*c - '0');
+        else if (*c == '-') negative = true;
+    }
+    return negative ? -value : value;
+}
+
+/* convert a fixed width decimal field */
+double AmeParser::parseDouble(const char *begin, const char *end, bool &estimated)
+{
+    DecimalAccumulator accumulator;
+    accumulator.feed(begin, end);
+    estimated = accumulator.estimated;
+    return accumulator.value();
+}
+
+/* convert a decimal split over two fields, as used for the atomic mass */
+double AmeParser::parseDouble(const char *begin1, const char *end1, const char *begin2, const char *end2, bool &estimated)
+{
+    DecimalAccumulator accumulator;
+    accumulator.feed(begin1, end1);
+    accumulator.feed(begin2, end2);
+    estimated = accumulator.estimated;
+    return accumulator.value();
+}
+
+/* constructor which sets the column layout */
+AmeStreamParser::AmeStreamParser(const AmeFormat &format)
+    : parser_(format)
+    , lineNumber_(0)
+    , count_(0)
+{
+}
+
+/* start again at the beginning of a table */
+void AmeStreamParser::reset()
+{
+    this->carry_.clear();
+    this->lineNumber_ = 0;
+    this->count_ = 0;
+}
@@ -0,0 +1,198 @@
+#ifndef AMEPARSER_H
+#define AMEPARSER_H
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+/* one row of an AME mass table converted straight to numbers */
+struct NuclideRecord
+{
+    int neutrons;
+    int protons;
+    int nucleons;
+    char element[4];                    // null terminated element symbol
+    double bindingEnergy;               // keV per nucleon
+    double bindingEnergyUncertainty;    // keV per nucleon
+    double atomicMass;                  // micro-u
+    double atomicMassUncertainty;       // micro-u
+    bool estimated;                     // true if any value carried a '#' marker
+};
+
+/* a fixed width field given as a zero based start column and a width */
+struct AmeField
+{
+    int start;
+    int width;
+};
+
+/* column layout of an AME mass table edition */
+struct AmeFormat
+{
+    int headerLines;
+    AmeField neutrons;
+    AmeField protons;
+    AmeField nucleons;
+    AmeField element;
+    AmeField bindingEnergy;
+    AmeField bindingEnergyUncertainty;
+    AmeField atomicMassInteger;
+    AmeField atomicMassFraction;
+    AmeField atomicMassUncertainty;
+
+    /* layout of mass16.txt (AME2016) */
+    static AmeFormat ame2016();
+
+    /* layout of mass_1.mas20.txt (AME2020) */
+    static AmeFormat ame2020();
+};
+
+/* parser for the fixed width AME tables working on a raw byte buffer, no intermediate strings are created */
+class AmeParser
+{
+private:
+    AmeFormat format_;
+
+    /* returns the shortest line length that holds every field */
+    int minimumLineLength() const;
+
+public:
+    explicit AmeParser(const AmeFormat &format = AmeFormat::ame2016());
+
+    /* returns the number of header lines before the first nuclide */
+    int headerLines() const { return this->format_.headerLines; }
+
+    /* parse a single data line (without the newline) - returns false if the line does not hold a nuclide */
+    bool parseLine(const char *line, std::size_t length, NuclideRecord &record) const;
+
+    /* parse a whole table held in memory and call sink(record) for every nuclide - returns the number of nuclides */
+    template <typename Sink>
+    std::size_t parse(const char *data, std::size_t size, Sink sink) const;
+
+    /* returns an upper bound on the number of nuclides in a buffer, used to size the table before parsing */
+    std::size_t countDataLines(const char *data, std::size_t size) const;
+
+    /* returns an upper bound on the number of nuclides in a table of the given size in bytes */
+    std::size_t estimateDataLines(std::size_t bytes) const;
+
+    /* returns the number of lines in a buffer, counting a last line without a newline */
+    static std::size_t countLines(const char *data, std::size_t size);
+
+    /* field conversion helpers - blanks are skipped, a '#' is read as the decimal point and an exponent is accepted */
+    static int parseInt(const char *begin, const char *end);
+    static double parseDouble(const char *begin, const char *end, bool &estimated);
+    static double parseDouble(const char *begin1, const char *end1, const char *begin2, const char *end2, bool &estimated);
+
+    /* field checks - blanks around the value are allowed, an empty field fails */
+    static bool isIntegerField(const char *begin, const char *end);
+    static bool isDecimalField(const char *begin, const char *end);
+};
+
+template <typename Sink>
+std::size_t AmeParser::parse(const char *data, std::size_t size, Sink sink) const
+{
+    const char *position = data;
+    const char *end = data + size;
+    int lineNumber = 0;
+    std::size_t count = 0;
+    NuclideRecord record;
+
+    while (position < end) {
+        /* find the end of the current line */
+        const char *newline = static_cast<const char *>(std::memchr(position, '\n', end - position));
+        const char *lineEnd = newline ? newline : end;
+
+        /* data starts after the header */
+        if (lineNumber >= this->format_.headerLines) {
+            if (this->parseLine(position, lineEnd - position, record)) {
+                sink(record);
+                count++;
+            }
+        }
+
+        lineNumber++;
+        position = newline ? newline + 1 : end;
+    }
+    return count;
+}
+
+/* incremental parser for an AME table arriving in chunks, e.g. from a network reply - complete lines are
+   parsed straight from each chunk and only a partial last line is carried over to the next one */
+class AmeStreamParser
+{
+private:
+    AmeParser parser_;
+    std::string carry_;
+    int lineNumber_;
+    std::size_t count_;
+
+    template <typename Sink>
+    void parseLine(const char *line, std::size_t length, Sink &sink);
+
+public:
+    explicit AmeStreamParser(const AmeFormat &format = AmeFormat::ame2016());
+
+    /* start again at the beginning of a table */
+    void reset();
+
+    /* parse the complete lines of a chunk and call sink(record) for every nuclide */
+    template <typename Sink>
+    void feed(const char *data, std::size_t size, Sink sink);
+
+    /* parse a final line which had no newline */
+    template <typename Sink>
+    void finish(Sink sink);
+
+    /* returns an upper bound on the number of nuclides in a table of the given size in bytes */
+    std::size_t estimateDataLines(std::size_t bytes) const { return this->parser_.estimateDataLines(bytes); }
+
+    /* returns the number of nuclides parsed so far */
+    std::size_t count() const { return this->count_; }
+};
+
+template <typename Sink>
+void AmeStreamParser::parseLine(const char *line, std::size_t length, Sink &sink)
+{
+    NuclideRecord record;
+    if (this->lineNumber_++ < this->parser_.headerLines()) return;
+    if (this->parser_.parseLine(line, length, record)) {
+        sink(record);
+        this->count_++;
+    }
+}
+
+template <typename Sink>
+void AmeStreamParser::feed(const char *data, std::size_t size, Sink sink)
+{
+    const char *position = data;
+    const char *end = data + size;
+
+    while (position < end) {
+        const char *newline = static_cast<const char *>(std::memchr(position, '\n', end - position));
+        if (!newline) {
+            /* keep the partial line until the rest of it arrives */
+            this->carry_.append(position, end - position);
+            return;
+        }
+        if (this->carry_.empty()) {
+            this->parseLine(position, newline - position, sink);
+        } else {
+            /* complete the line left over from the previous chunk */
+            this->carry_.append(position, newline - position);
+            this->parseLine(this->carry_.data(), this->carry_.size(), sink);
+            this->carry_.clear();
+        }
+        position = newline + 1;
+    }
+}
+
+template <typename Sink>
+void AmeStreamParser::finish(Sink sink)
+{
+    if (!this->carry_.empty()) {
+        this->parseLine(this->carry_.data(), this->carry_.size(), sink);
+        this->carry_.clear();
+    }
+}
+
+#endif // AMEPARSER_H
@@ -0,0 +1,19 @@
+#include "atom.h"
+
+/* default empty contructor - needed to initialise array of objects */
+Atom::Atom()
+{
+}
+
+/* contructor which initialises atom with values */
+Atom::Atom(int neutrons, int protons, int nucleons, std::string element, double bindingEnergy, double bindingEnergyUncertainty, double atomicMass, double atomicMassUncertainty)
+{
+    this->neutrons_ = neutrons;
+    this->protons_ = protons;
+    this->nucleons_ = nucleons;
+    this->element_ = element;
+    this->bindingEnergy_ = bindingEnergy;
+    this->bindingEnergyUncertainty_ = bindingEnergyUncertainty;
+    this->atomicMass_ = atomicMass * 1.0e-6;                        // convert to u
+    this->atomicMassUncertainty_ = atomicMassUncertainty * 1.0e-6;  // convert to u
+}
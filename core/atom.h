@@ -0,0 +1,104 @@
+#ifndef ATOM_H
+#define ATOM_H
+
+#include <string>
+#include "constants.h"
+#include "electronbinding.h"
+
+class Atom
+{
+private:
+    /* Private class members */
+    int neutrons_;
+    int protons_;
+    int nucleons_;
+    std::string element_;
+    double bindingEnergy_;
+    double bindingEnergyUncertainty_;
+    double atomicMass_;
+    double atomicMassUncertainty_;
+
+public:
+    /* Atom default constructor */
+    Atom();
+
+    /* Atom constructor with data */
+    Atom(int neutrons, int protons, int nucleons, std::string element, double bindingEnergy, double bindingEnergyUncertainty, double atomicMass, double atomicMassUncertainty);
+
+    /* getters */
+    int getNeutrons() { return this->neutrons_; }
+    int getProtons() { return this->protons_; }
+    int getNucleons()  { return this->nucleons_; }
+    std::string getElement()  { return this->element_; }
+    double getBindingEnergy() { return this->bindingEnergy_; }
+    double getBindingEnergyUncertainty() { return this->bindingEnergyUncertainty_; }
+    double getAtomicMass() { return this->atomicMass_; }
+    double getAtomicMassUncertainty() { return this->atomicMassUncertainty_; }
+
+    /* getters for numerical constants */
+    template <typename Constants> static constexpr double getElectronCharge() { return Constants::electronCharge; }
+    template <typename Constants> static constexpr double getAtomicMassUnit() { return Constants::amu; }
+    template <typename Constants> static constexpr double getSpeedofLight() { return Constants::speedofLight; }
+    template <typename Constants> static constexpr double getElectronMass() { return Constants::electronMass; }
+    template <typename Constants> static constexpr double getProtonMass() { return Constants::protonMass; }
+    template <typename Constants> static constexpr double getNeutronMass() { return Constants::neutronMass; }
+
+    /* functions to calculate nuclear properties with a set of constants */
+    template <typename Constants> double calcNuclearMass(ElectronBindingModel electronBinding = ElectronBindingNone) const;
+    template <typename Constants> double calcMassDefectamuAlt() const;
+    template <typename Constants> double calcMassDefectamu() const;
+    template <typename Constants> double calcMassDefectkg() const;
+    template <typename Constants> double calcBindingEnergyJ() const;
+    template <typename Constants> double calcBindingEnergykeV() const;
+    template <typename Constants> double calcBindingEnergyperNucleonkeV() const;
+};
+
+/* returns the nuclear mass given the atomic mass and proton number - the electron binding energy is added back if a model is given */
+template <typename Constants>
+double Atom::calcNuclearMass(ElectronBindingModel electronBinding) const {
+    const double nuclearMass = this->atomicMass_ - (this->protons_ * Constants::electronMass);
+    if (electronBinding == ElectronBindingNone) return nuclearMass;
+    return nuclearMass + (ElectronBinding::energy(electronBinding, this->protons_) * 1e-3) / Constants::amutokeV;
+}
+
+/* returns the nuclear mass defect given the atomic mass, proton number and neutron number - this uses the calculated nuclear mass */
+template <typename Constants>
+double Atom::calcMassDefectamuAlt() const {
+    return ((this->protons_ * Constants::protonMass + this->neutrons_ * Constants::neutronMass) - this->calcNuclearMass<Constants>());
+}
+
+/* returns the nuclear mass defect given the atomic mass, proton number and neutron number - the accurate set uses the hydrogen mass to give agreement with database values */
+template <typename Constants>
+double Atom::calcMassDefectamu() const {
+    if constexpr (Constants::hydrogenMassDefect) {
+        return ((this->protons_ * Constants::hydrogenMass + this->neutrons_ * Constants::neutronMass) - this->atomicMass_);
+    } else {
+        return ((this->protons_ * Constants::protonMass + this->neutrons_ * Constants::neutronMass) - this->calcNuclearMass<Constants>());
+    }
+}
+
+/* returns the nuclear mass defect in kg */
+template <typename Constants>
+double Atom::calcMassDefectkg() const {
+    return (this->calcMassDefectamu<Constants>() * Constants::amu);
+}
+
+/* returns the total nuclear binding energy in J given the mass defect in kg */
+template <typename Constants>
+double Atom::calcBindingEnergyJ() const {
+    return (this->calcMassDefectkg<Constants>() * (Constants::speedofLight * Constants::speedofLight));
+}
+
+/* returns the total nuclear binding energy given the mass defect */
+template <typename Constants>
+double Atom::calcBindingEnergykeV() const {
+    return (this->calcMassDefectamu<Constants>() * Constants::amutokeV);
+}
+
+/* returns the nuclear binding energy pernucleon given the total binding energy and number of nucleons */
+template <typename Constants>
+double Atom::calcBindingEnergyperNucleonkeV() const {
+    return (this->calcBindingEnergykeV<Constants>() / this->nucleons_);
+}
+
+#endif // ATOM_H
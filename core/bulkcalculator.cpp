@@ -0,0 +1,110 @@
+#include "bulkcalculator.h"
+
+/* nuclear mass in u - atomic mass less the electron masses, plus the electron binding energy read from the per Z table */
+template <typename Constants>
+void BulkCalculator::calcNuclearMass(const NuclideTable &table, double *out, ElectronBindingModel electronBinding)
+{
+    const std::int16_t *__restrict protons = table.protons().data();
+    const double *__restrict atomicMass = table.atomicMass().data();
+    double *__restrict result = out;
+    const int count = table.size();
+
+    if (electronBinding == ElectronBindingNone) {
+        #pragma omp simd
+        for (int i = 0; i < count; i++) {
+            const double mass = atomicMass[i] * 1.0e-6;
+            result[i] = mass - (protons[i] * Constants::electronMass);
+        }
+        return;
+    }
+
+    /* proton numbers past the table are clamped here and put right below */
+    const double *__restrict bindingEnergy = ElectronBinding::table(electronBinding);
+    const int lastProtons = ElectronBinding::tableSize - 1;
+    #pragma omp simd
+    for (int i = 0; i < count; i++) {
+        const double mass = atomicMass[i] * 1.0e-6;
+        const int z = protons[i] < lastProtons ? protons[i] : lastProtons;
+        result[i] = (mass - (protons[i] * Constants::electronMass)) + (bindingEnergy[z] * 1e-3) / Constants::amutokeV;
+    }
+    for (int i = 0; i < count; i++) {
+        if (protons[i] <= lastProtons) continue;
+        const double mass = atomicMass[i] * 1.0e-6;
+        result[i] = (mass - (protons[i] * Constants::electronMass)) + (ElectronBinding::evaluate(electronBinding, protons[i]) * 1e-3) / Constants::amutokeV;
+    }
+}
+
+/* nuclear mass defect in u */
+template <typename Constants>
+void BulkCalculator::calcMassDefectamu(const NuclideTable &table, double *out)
+{
+    massDefect<Constants, false>(table, 1.0, 1.0, out);
+}
+
+/* nuclear mass defect in kg */
+template <typename Constants>
+void BulkCalculator::calcMassDefectkg(const NuclideTable &table, double *out)
+{
+    massDefect<Constants, false>(table, Constants::amu, 1.0, out);
+}
+
+/* total binding energy in J - the mass defect in kg times c squared */
+template <typename Constants>
+void BulkCalculator::calcBindingEnergyJ(const NuclideTable &table, double *out)
+{
+    massDefect<Constants, false>(table, Constants::amu, Constants::speedofLight * Constants::speedofLight, out);
+}
+
+/* total binding energy in keV */
+template <typename Constants>
+void BulkCalculator::calcBindingEnergykeV(const NuclideTable &table, double *out)
+{
+    massDefect<Constants, false>(table, Constants::amutokeV, 1.0, out);
+}
+
+/* binding energy per nucleon in keV */
+template <typename Constants>
+void BulkCalculator::calcBindingEnergyperNucleonkeV(const NuclideTable &table, double *out)
+{
+    massDefect<Constants, true>(table, Constants::amutokeV, 1.0, out);
+}
+
+/* fused mass defect kernel - ((defect * scale) * secondScale) / A when perNucleon is set. A scale of 1.0
+   is exact, so the unscaled quantities round exactly as the scalar functions do. The accurate set uses
+   the hydrogen mass to agree with the database values. */
+template <typename Constants, bool perNucleon>
+void BulkCalculator::massDefect(const NuclideTable &table, double scale, double secondScale, double *out)
+{
+    const std::int16_t *__restrict protons = table.protons().data();
+    const std::int16_t *__restrict neutrons = table.neutrons().data();
+    const std::int16_t *__restrict nucleons = table.nucleons().data();
+    const double *__restrict atomicMass = table.atomicMass().data();
+    double *__restrict result = out;
+    const int count = table.size();
+
+    #pragma omp simd
+    for (int i = 0; i < count; i++) {
+        const double mass = atomicMass[i] * 1.0e-6;
+        double defect;
+        if constexpr (Constants::hydrogenMassDefect) {
+            defect = (protons[i] * Constants::hydrogenMass + neutrons[i] * Constants::neutronMass) - mass;
+        } else {
+            defect = (protons[i] * Constants::protonMass + neutrons[i] * Constants::neutronMass) - (mass - (protons[i] * Constants::electronMass));
+        }
+        defect = (defect * scale) * secondScale;
+        if (perNucleon) defect = defect / nucleons[i];
+        result[i] = defect;
+    }
+}
+
+/* instantiate the kernels for each constant set - a new set needs a line here */
+#define BULKCALCULATOR_INSTANTIATE(Constants) \
+    template void BulkCalculator::calcNuclearMass<Constants>(const NuclideTable &, double *, ElectronBindingModel); \
+    template void BulkCalculator::calcMassDefectamu<Constants>(const NuclideTable &, double *); \
+    template void BulkCalculator::calcMassDefectkg<Constants>(const NuclideTable &, double *); \
+    template void BulkCalculator::calcBindingEnergyJ<Constants>(const NuclideTable &, double *); \
+    template void BulkCalculator::calcBindingEnergykeV<Constants>(const NuclideTable &, double *); \
+    template void BulkCalculator::calcBindingEnergyperNucleonkeV<Constants>(const NuclideTable &, double *);
+
+BULKCALCULATOR_INSTANTIATE(AccurateConstants)
+BULKCALCULATOR_INSTANTIATE(ALevelConstants)
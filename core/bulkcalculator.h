@@ -0,0 +1,33 @@
+#ifndef BULKCALCULATOR_H
+#define BULKCALCULATOR_H
+
+#include <cstdint>
+#include "constants.h"
+#include "nuclidetable.h"
+
+/*
+ * Whole-table versions of the Atom calculations. Each function makes one branch free, omp simd
+ * vectorised pass over the columns it needs and writes one result per row to out, which must have room for table.size()
+ * values. The functions are templated on the constant set (see constants.h), so the constants
+ * are folded into each kernel at compile time. The arithmetic is the same, in the same order, as the scalar Atom functions so the
+ * results match them bit for bit, as long as the compiler is not allowed to contract a multiply
+ * and add into a fused multiply-add (no -ffp-contract=fast with FMA enabled); if it is, each
+ * result stays within 1 ULP of the scalar value.
+ */
+class BulkCalculator
+{
+public:
+    template <typename Constants> static void calcNuclearMass(const NuclideTable &table, double *out, ElectronBindingModel electronBinding = ElectronBindingNone);
+    template <typename Constants> static void calcMassDefectamu(const NuclideTable &table, double *out);
+    template <typename Constants> static void calcMassDefectkg(const NuclideTable &table, double *out);
+    template <typename Constants> static void calcBindingEnergyJ(const NuclideTable &table, double *out);
+    template <typename Constants> static void calcBindingEnergykeV(const NuclideTable &table, double *out);
+    template <typename Constants> static void calcBindingEnergyperNucleonkeV(const NuclideTable &table, double *out);
+
+private:
+    /* fused kernel over the table columns - the mass is in micro-u as stored in the table */
+    template <typename Constants, bool perNucleon>
+    static void massDefect(const NuclideTable &table, double scale, double secondScale, double *out);
+};
+
+#endif // BULKCALCULATOR_H
@@ -0,0 +1,42 @@
+#ifndef CONSTANTS_H
+#define CONSTANTS_H
+
+/*
+ * Sets of numerical constants. Calculations are templated on a constant set, so each instantiation
+ * folds its constants at compile time and different sets can be used at the same time from
+ * different threads. A new set (e.g. a later CODATA evaluation) only needs a struct with the same
+ * members.
+ */
+
+/* accurate numerical constants */
+struct AccurateConstants
+{
+    static constexpr double amu = 1.660539040e-27;
+    static constexpr double electronMass = 5.48579909070e-4;
+    static constexpr double protonMass = 1.00727646693;
+    static constexpr double hydrogenMass = 1.00782503224;
+    static constexpr double neutronMass = 1.00866491582;
+    static constexpr double speedofLight = 2.99792458e8;
+    static constexpr double electronCharge = 1.0000000983 * 1.602176634e-19;
+    static constexpr double amutokeV = 931494.0038;
+
+    /* use the hydrogen atom mass in the mass defect to give agreement with database values */
+    static constexpr bool hydrogenMassDefect = true;
+};
+
+/* a-level numerical constants */
+struct ALevelConstants
+{
+    static constexpr double amu = 1.661e-27;
+    static constexpr double electronMass = 5.485e-4;
+    static constexpr double protonMass = 1.0072;
+    static constexpr double neutronMass = 1.0084;
+    static constexpr double speedofLight = 3.00e8;
+    static constexpr double electronCharge = 1.60e-19;
+    static constexpr double amutokeV = amu * (speedofLight * speedofLight) / electronCharge * 1e-3;
+
+    /* use the proton mass and the nuclear mass in the mass defect */
+    static constexpr bool hydrogenMassDefect = false;
+};
+
+#endif // CONSTANTS_H
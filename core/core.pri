@@ -0,0 +1,15 @@
+# Link against the core library - include this from the project file of every program which uses it
+
+INCLUDEPATH += $$PWD
+DEPENDPATH += $$PWD
+
+CORE_BUILD = $$shadowed($$PWD)
+win32:CONFIG(release, debug|release): CORE_BUILD = $$CORE_BUILD/release
+else:win32:CONFIG(debug, debug|release): CORE_BUILD = $$CORE_BUILD/debug
+
+LIBS += -L$$CORE_BUILD -latomicdatacore
+win32-g++|!win32: PRE_TARGETDEPS += $$CORE_BUILD/libatomicdatacore.a
+else: PRE_TARGETDEPS += $$CORE_BUILD/atomicdatacore.lib
+
+# the library uses std::thread
+unix: LIBS += -pthread
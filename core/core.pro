@@ -0,0 +1,49 @@
+# Core library - nuclide store, AME parsers, index and calculations. Only the loader uses Qt (QtCore and
+# QtNetwork), so code which does not load through it links without Qt.
+
+QT = core network
+
+TEMPLATE = lib
+TARGET = atomicdatacore
+CONFIG += staticlib c++17
+
+# let the bulk calculation loops marked with omp simd vectorise without pulling in OpenMP
+gcc|clang: QMAKE_CXXFLAGS += -fopenmp-simd
+
+SOURCES += \
+    ameparser.cpp \
+    atom.cpp \
+    bulkcalculator.cpp \
+    electronbinding.cpp \
+    elements.cpp \
+    garveykelson.cpp \
+    nuclidecache.cpp \
+    nuclidecsv.cpp \
+    nuclideindex.cpp \
+    nuclideloader.cpp \
+    nuclideselection.cpp \
+    nuclidetable.cpp \
+    qvalues.cpp \
+    semf.cpp \
+    separationenergies.cpp \
+    uncertainty.cpp
+
+HEADERS += \
+    ameparser.h \
+    atom.h \
+    bulkcalculator.h \
+    constants.h \
+    electronbinding.h \
+    elements.h \
+    garveykelson.h \
+    nuclidecache.h \
+    nuclidecsv.h \
+    nuclideindex.h \
+    nuclideloader.h \
+    nuclideselection.h \
+    nuclidetable.h \
+    parallel.h \
+    qvalues.h \
+    semf.h \
+    separationenergies.h \
+    uncertainty.h
@@ -0,0 +1,43 @@
+#include "electronbinding.h"
+
+static const char *const electronBindingModelNames_[numberOfElectronBindingModels] = {
+    "None", "Lunney", "Thomas-Fermi"
+};
+
+/* the tables of every model, built together the first time one is needed */
+struct ElectronBindingTables
+{
+    double energies[numberOfElectronBindingModels][ElectronBinding::tableSize];
+
+    ElectronBindingTables() {
+        for (int model = 0; model < numberOfElectronBindingModels; model++) {
+            for (int protons = 0; protons < ElectronBinding::tableSize; protons++) {
+                this->energies[model][protons] = ElectronBinding::evaluate(static_cast<ElectronBindingModel>(model), protons);
+            }
+        }
+    }
+};
+
+/* returns the table of binding energies in eV indexed by proton number */
+const double *ElectronBinding::table(ElectronBindingModel model)
+{
+    static const ElectronBindingTables tables;
+    return tables.energies[model];
+}
+
+/* total electron binding energy in eV evaluated from the model formula */
+double ElectronBinding::evaluate(ElectronBindingModel model, int protons)
+{
+    if (protons <= 0) return 0;
+    switch (model) {
+    case ElectronBindingLunney: return 14.4381 * std::pow(protons, 2.39) + 1.55468e-6 * std::pow(protons, 5.35);
+    case ElectronBindingThomasFermi: return 14.33 * std::pow(protons, 2.39);
+    default: return 0;
+    }
+}
+
+/* returns the name of a model */
+const char *ElectronBinding::modelName(ElectronBindingModel model)
+{
+    return electronBindingModelNames_[model];
+}
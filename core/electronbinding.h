@@ -0,0 +1,42 @@
+#ifndef ELECTRONBINDING_H
+#define ELECTRONBINDING_H
+
+#include <cmath>
+
+/* models of the total binding energy of the electrons of a neutral atom */
+enum ElectronBindingModel
+{
+    ElectronBindingNone,            // electron binding ignored
+    ElectronBindingLunney,          // 14.4381 Z^2.39 + 1.55468e-6 Z^5.35 eV (Lunney, Pearson and Thibault 2003)
+    ElectronBindingThomasFermi,     // 14.33 Z^2.39 eV
+    numberOfElectronBindingModels
+};
+
+/*
+ * Electron binding energies by proton number. Each model is tabulated once, on first use, for every
+ * Z up to tableSize, so a correction costs one array read instead of two calls to std::pow. Larger
+ * Z is evaluated directly.
+ */
+class ElectronBinding
+{
+public:
+    /* number of proton numbers held in each table - covers every known element */
+    static constexpr int tableSize = 128;
+
+    /* returns the table of binding energies in eV indexed by proton number */
+    static const double *table(ElectronBindingModel model);
+
+    /* total electron binding energy in eV evaluated from the model formula */
+    static double evaluate(ElectronBindingModel model, int protons);
+
+    /* total electron binding energy in eV */
+    static double energy(ElectronBindingModel model, int protons) {
+        if (protons >= 0 && protons < tableSize) return table(model)[protons];
+        return evaluate(model, protons);
+    }
+
+    /* returns the name of a model */
+    static const char *modelName(ElectronBindingModel model);
+};
+
+#endif // ELECTRONBINDING_H
@@ -0,0 +1,30 @@
+#include "elements.h"
+#include <cstring>
+
+/* element symbols indexed by proton number, as used in the AME tables */
+static const char *const elementSymbols_[numberOfElementSymbols] = {
+    "n",  "H",  "He", "Li", "Be", "B",  "C",  "N",  "O",  "F",  "Ne", "Na", "Mg", "Al", "Si", "P",
+    "S",  "Cl", "Ar", "K",  "Ca", "Sc", "Ti", "V",  "Cr", "Mn", "Fe", "Co", "Ni", "Cu", "Zn", "Ga",
+    "Ge", "As", "Se", "Br", "Kr", "Rb", "Sr", "Y",  "Zr", "Nb", "Mo", "Tc", "Ru", "Rh", "Pd", "Ag",
+    "Cd", "In", "Sn", "Sb", "Te", "I",  "Xe", "Cs", "Ba", "La", "Ce", "Pr", "Nd", "Pm", "Sm", "Eu",
+    "Gd", "Tb", "Dy", "Ho", "Er", "Tm", "Yb", "Lu", "Hf", "Ta", "W",  "Re", "Os", "Ir", "Pt", "Au",
+    "Hg", "Tl", "Pb", "Bi", "Po", "At", "Rn", "Fr", "Ra", "Ac", "Th", "Pa", "U",  "Np", "Pu", "Am",
+    "Cm", "Bk", "Cf", "Es", "Fm", "Md", "No", "Lr", "Rf", "Db", "Sg", "Bh", "Hs", "Mt", "Ds", "Rg",
+    "Cn", "Nh", "Fl", "Mc", "Lv", "Ts", "Og"
+};
+
+/* returns the element symbol for a symbol id */
+const char *elementSymbol(int symbolId)
+{
+    if (symbolId < 0 || symbolId >= numberOfElementSymbols) return "";
+    return elementSymbols_[symbolId];
+}
+
+/* returns the symbol id of an element symbol */
+int elementSymbolId(const char *symbol)
+{
+    for (int i = 0; i < numberOfElementSymbols; i++) {
+        if (std::strcmp(elementSymbols_[i], symbol) == 0) return i;
+    }
+    return -1;
+}
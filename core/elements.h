@@ -0,0 +1,13 @@
+#ifndef ELEMENTS_H
+#define ELEMENTS_H
+
+/* number of entries in the symbol table - the free neutron followed by Z = 1 to 118 */
+static constexpr int numberOfElementSymbols = 119;
+
+/* returns the element symbol for a symbol id, the symbol id of an element is its proton number */
+const char *elementSymbol(int symbolId);
+
+/* returns the symbol id of an element symbol or -1 if it is not known */
+int elementSymbolId(const char *symbol);
+
+#endif // ELEMENTS_H
@@ -0,0 +1,204 @@
+#include "garveykelson.h"
+#include "constants.h"
+#include "parallel.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+/* state of a grid cell */
+enum GarveyKelsonCell : std::uint8_t
+{
+    CellUnknown,
+    CellMeasured,
+    CellPredicted,
+    CellUnbound         // a prediction which was past a drip line - never tried again
+};
+
+/* one nuclide of a relation as offsets from the relation origin and its sign */
+struct GarveyKelsonPoint
+{
+    int neutrons;
+    int protons;
+    int sign;
+};
+
+static constexpr int relationPoints_ = 6;
+static constexpr int numberOfRelations_ = 2;
+
+/* transverse and longitudinal relations - the signed sum of the six binding energies is zero */
+static constexpr GarveyKelsonPoint relations_[numberOfRelations_][relationPoints_] = {
+    {{2, -2, 1}, {0, 0, -1}, {0, -1, 1}, {1, -2, -1}, {1, 0, 1}, {2, -1, -1}},
+    {{2, 0, 1}, {0, -2, -1}, {1, -2, 1}, {2, -1, -1}, {0, -1, 1}, {1, 0, -1}}
+};
+
+/* the (Z, N) grid a sweep reads or writes */
+struct GarveyKelsonGrid
+{
+    int width;          // neutron numbers 0 .. width - 1
+    int height;         // proton numbers 0 .. height - 1
+    std::vector<double> energy;
+    std::vector<double> variance;
+    std::vector<std::uint8_t> state;
+
+    std::size_t cell(int protons, int neutrons) const { return static_cast<std::size_t>(protons) * this->width + neutrons; }
+    bool known(int protons, int neutrons) const {
+        if (protons < 0 || protons >= this->height || neutrons < 0 || neutrons >= this->width) return false;
+        const std::uint8_t cellState = this->state[this->cell(protons, neutrons)];
+        return cellState == CellMeasured || cellState == CellPredicted;
+    }
+};
+
+/* constructor */
+GarveyKelson::GarveyKelson(const GarveyKelsonOptions &options)
+    : options_(options)
+    , sweeps_(0)
+    , predicted_(0)
+{
+}
+
+/* copy the table into output together with the predicted nuclides */
+int GarveyKelson::extrapolate(const NuclideTable &input, NuclideTable &output)
+{
+    const int count = input.size();
+    const ColumnSpan<std::int16_t> protons = input.protons();
+    const ColumnSpan<std::int16_t> neutrons = input.neutrons();
+    const ColumnSpan<std::int16_t> nucleons = input.nucleons();
+
+    /* size the grid from the table */
+    int maxProtons = 0;
+    int maxNeutrons = 0;
+    for (int row = 0; row < count; row++) {
+        maxProtons = std::max<int>(maxProtons, protons[row]);
+        maxNeutrons = std::max<int>(maxNeutrons, neutrons[row]);
+    }
+    GarveyKelsonGrid grid;
+    grid.width = maxNeutrons + 1 + std::max(this->options_.neutronPadding, 0);
+    grid.height = maxProtons + 1;
+    const std::size_t cells = static_cast<std::size_t>(grid.width) * grid.height;
+    grid.energy.assign(cells, 0.0);
+    grid.variance.assign(cells, 0.0);
+    grid.state.assign(cells, CellUnknown);
+
+    /* measured total binding energies in keV - the first row wins if a nuclide appears twice */
+    std::vector<int> rowOfCell(cells, -1);
+    for (int row = count - 1; row >= 0; row--) {
+        if (protons[row] < 0 || neutrons[row] < 0 || nucleons[row] <= 0) continue;
+        const std::size_t cell = grid.cell(protons[row], neutrons[row]);
+        const double uncertainty = input.bindingEnergyUncertainty()[row] * nucleons[row];
+        grid.energy[cell] = input.bindingEnergy()[row] * nucleons[row];
+        grid.variance[cell] = uncertainty * uncertainty;
+        grid.state[cell] = CellMeasured;
+        rowOfCell[cell] = row;
+    }
+
+    /* Jacobi sweeps until nothing more can be predicted */
+    GarveyKelsonGrid next = grid;
+    this->sweeps_ = 0;
+    this->predicted_ = 0;
+    const int minimumProtons = std::max(this->options_.minimumProtons, 0);
+    while (this->sweeps_ < this->options_.maximumSweeps) {
+        const int added = parallelReduce(static_cast<std::size_t>(grid.height), 0,
+            [&](std::size_t begin, std::size_t end) {
+                int rowAdded = 0;
+                for (int z = static_cast<int>(begin); z < static_cast<int>(end); z++) {
+                    if (z < minimumProtons) continue;
+                    for (int n = 0; n < grid.width; n++) {
+                        const std::size_t cell = grid.cell(z, n);
+                        if (grid.state[cell] != CellUnknown) continue;
+
+                        /* every relation with this cell at any of its six points */
+                        double sum = 0;
+                        double sumOfSquares = 0;
+                        double inputVariance = 0;
+                        int estimates = 0;
+                        for (int relation = 0; relation < numberOfRelations_; relation++) {
+                            for (int target = 0; target < relationPoints_; target++) {
+                                const GarveyKelsonPoint &targetPoint = relations_[relation][target];
+                                const int originNeutrons = n - targetPoint.neutrons;
+                                const int originProtons = z - targetPoint.protons;
+                                double estimate = 0;
+                                double estimateVariance = 0;
+                                bool complete = true;
+                                for (int point = 0; point < relationPoints_ && complete; point++) {
+                                    if (point == target) continue;
+                                    const GarveyKelsonPoint &other = relations_[relation][point];
+                                    const int otherProtons = originProtons + other.protons;
+                                    const int otherNeutrons = originNeutrons + other.neutrons;
+                                    if (!grid.known(otherProtons, otherNeutrons)) {
+                                        complete = false;
+                                        break;
+                                    }
+                                    const std::size_t otherCell = grid.cell(otherProtons, otherNeutrons);
+                                    estimate -= other.sign * grid.energy[otherCell];
+                                    estimateVariance += grid.variance[otherCell];
+                                }
+                                if (!complete) continue;
+                                estimate *= targetPoint.sign;
+                                sum += estimate;
+                                sumOfSquares += estimate * estimate;
+                                inputVariance += estimateVariance;
+                                estimates++;
+                            }
+                        }
+                        if (estimates == 0) continue;
+
+                        const double energy = sum / estimates;
+                        const double spread = estimates > 1 ? std::max(sumOfSquares / estimates - energy * energy, 0.0) : 0.0;
+
+                        /* stop at the drip lines - the nuclide must be bound to one neutron and one proton emission */
+                        const bool neutronUnbound = grid.known(z, n - 1) && energy - grid.energy[grid.cell(z, n - 1)] <= 0;
+                        const bool protonUnbound = grid.known(z - 1, n) && energy - grid.energy[grid.cell(z - 1, n)] <= 0;
+                        if (neutronUnbound || protonUnbound) {
+                            next.state[cell] = CellUnbound;
+                            continue;
+                        }
+                        next.energy[cell] = energy;
+                        next.variance[cell] = inputVariance / estimates + spread;
+                        next.state[cell] = CellPredicted;
+                        rowAdded++;
+                    }
+                }
+                return rowAdded;
+            },
+            [](int &total, const int &partial) { total += partial; }, 4);
+
+        /* the next sweep reads what this one wrote */
+        grid.energy = next.energy;
+        grid.variance = next.variance;
+        grid.state = next.state;
+        this->sweeps_++;
+        this->predicted_ += added;
+        if (added == 0) break;
+    }
+
+    /* merge the measured and predicted nuclides in order of A and then Z */
+    output.clear();
+    output.reserve(count + this->predicted_);
+    const int maxNucleons = grid.height - 1 + grid.width - 1;
+    NuclideRecord record;
+    for (int a = 0; a <= maxNucleons; a++) {
+        for (int z = std::max(0, a - (grid.width - 1)); z <= std::min(a, grid.height - 1); z++) {
+            const int n = a - z;
+            const std::size_t cell = grid.cell(z, n);
+            if (grid.state[cell] == CellMeasured) {
+                input.record(rowOfCell[cell], record);
+                output.append(record, input.flags()[rowOfCell[cell]]);
+            } else if (grid.state[cell] == CellPredicted) {
+                /* atomic mass in micro-u from the binding energy, as AME defines it */
+                const double uncertainty = std::sqrt(grid.variance[cell]);
+                record.neutrons = n;
+                record.protons = z;
+                record.nucleons = a;
+                std::strncpy(record.element, z < numberOfElementSymbols ? elementSymbol(z) : "", sizeof(record.element) - 1);
+                record.element[sizeof(record.element) - 1] = '\0';
+                record.bindingEnergy = grid.energy[cell] / a;
+                record.bindingEnergyUncertainty = uncertainty / a;
+                record.atomicMass = ((z * AccurateConstants::hydrogenMass + n * AccurateConstants::neutronMass) - grid.energy[cell] / AccurateConstants::amutokeV) * 1.0e6;
+                record.atomicMassUncertainty = uncertainty / AccurateConstants::amutokeV * 1.0e6;
+                record.estimated = false;
+                output.append(record, NuclideExtrapolated);
+            }
+        }
+    }
+    return this->predicted_;
+}
@@ -0,0 +1,46 @@
+#ifndef GARVEYKELSON_H
+#define GARVEYKELSON_H
+
+#include <cstdint>
+#include <vector>
+#include "nuclidetable.h"
+
+/* settings of a Garvey-Kelson extrapolation */
+struct GarveyKelsonOptions
+{
+    int maximumSweeps = 200;        // stop after this many sweeps even if nuclides are still being added
+    int neutronPadding = 60;        // how far past the most neutron rich nuclide of the table the grid reaches
+    int minimumProtons = 1;         // no predictions below this proton number
+};
+
+/*
+ * Garvey-Kelson mass extrapolation. The transverse and longitudinal relations each tie six
+ * neighbouring total binding energies together with alternating signs, so any one of them follows
+ * from the other five. Every sweep predicts each missing (Z, N) cell from all the relations whose
+ * other five nuclides are already known, averages the estimates, and fills the cell if the result
+ * is bound to one neutron and one proton emission. The sweeps are Jacobi style - each reads only the
+ * grid left by the previous sweep - so the rows of the grid are split over the cores and the result
+ * does not depend on the thread count. The extrapolation has converged when a sweep adds nothing,
+ * which happens once the predictions reach the drip lines.
+ */
+class GarveyKelson
+{
+private:
+    GarveyKelsonOptions options_;
+    int sweeps_;
+    int predicted_;
+
+public:
+    explicit GarveyKelson(const GarveyKelsonOptions &options = GarveyKelsonOptions());
+
+    /* copy the table into output together with the predicted nuclides, ordered by A and then Z. Predicted rows
+       carry NuclideExtrapolated and an uncertainty from the input uncertainties and the spread of the estimates.
+       Returns the number of predicted nuclides. */
+    int extrapolate(const NuclideTable &input, NuclideTable &output);
+
+    /* sweeps made and nuclides predicted by the last extrapolation */
+    int sweeps() const { return this->sweeps_; }
+    int predicted() const { return this->predicted_; }
+};
+
+#endif // GARVEYKELSON_H
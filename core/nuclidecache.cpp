@@ -0,0 +1,148 @@
+#include "nuclidecache.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+/* header at the start of the cache file */
+struct NuclideCacheHeader
+{
+    char magic[8];
+    std::uint32_t byteOrder;
+    std::uint32_t version;
+    std::uint32_t count;
+    std::uint32_t reserved;
+    std::uint64_t payloadSize;
+    std::uint64_t checksum;
+    char padding[24];
+};
+static_assert(sizeof(NuclideCacheHeader) == 64, "cache header must be 64 bytes");
+
+static constexpr char cacheMagic_[8] = {'A', 'M', 'D', 'C', 'A', 'C', 'H', 'E'};
+static constexpr std::uint32_t cacheByteOrder_ = 0x01020304;
+
+/* rounds a byte offset up to the next 8 byte boundary */
+static inline std::size_t align8(std::size_t offset)
+{
+    return (offset + 7) & ~static_cast<std::size_t>(7);
+}
+
+/* 64 bit FNV-1a hash of the column data */
+static std::uint64_t checksum(const char *data, std::size_t size)
+{
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (std::size_t i = 0; i < size; i++) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/* returns the byte offsets of the columns for a given number of nuclides */
+NuclideCacheLayout NuclideCacheLayout::forCount(std::size_t count)
+{
+    NuclideCacheLayout layout;
+    std::size_t offset = sizeof(NuclideCacheHeader);
+    layout.neutrons = offset;                   offset = align8(offset + count * sizeof(std::int16_t));
+    layout.protons = offset;                    offset = align8(offset + count * sizeof(std::int16_t));
+    layout.nucleons = offset;                   offset = align8(offset + count * sizeof(std::int16_t));
+    layout.symbols = offset;                    offset = align8(offset + count * sizeof(std::uint8_t));
+    layout.flags = offset;                      offset = align8(offset + count * sizeof(std::uint8_t));
+    layout.bindingEnergy = offset;              offset += count * sizeof(double);
+    layout.bindingEnergyUncertainty = offset;   offset += count * sizeof(double);
+    layout.atomicMass = offset;                 offset += count * sizeof(double);
+    layout.atomicMassUncertainty = offset;      offset += count * sizeof(double);
+    layout.fileSize = offset;
+    return layout;
+}
+
+/* write the cache file */
+bool NuclideCacheWriter::write(const std::string &fileName, const NuclideTable &table)
+{
+    /* lay out the whole file in memory so the checksum can be taken over the columns */
+    const std::size_t count = static_cast<std::size_t>(table.size());
+    const NuclideCacheLayout layout = NuclideCacheLayout::forCount(count);
+    std::vector<char> buffer(layout.fileSize, 0);
+
+    std::memcpy(buffer.data() + layout.neutrons, table.neutrons().data(), count * sizeof(std::int16_t));
+    std::memcpy(buffer.data() + layout.protons, table.protons().data(), count * sizeof(std::int16_t));
+    std::memcpy(buffer.data() + layout.nucleons, table.nucleons().data(), count * sizeof(std::int16_t));
+    std::memcpy(buffer.data() + layout.symbols, table.symbols().data(), count * sizeof(std::uint8_t));
+    std::memcpy(buffer.data() + layout.flags, table.flags().data(), count * sizeof(std::uint8_t));
+    std::memcpy(buffer.data() + layout.bindingEnergy, table.bindingEnergy().data(), count * sizeof(double));
+    std::memcpy(buffer.data() + layout.bindingEnergyUncertainty, table.bindingEnergyUncertainty().data(), count * sizeof(double));
+    std::memcpy(buffer.data() + layout.atomicMass, table.atomicMass().data(), count * sizeof(double));
+    std::memcpy(buffer.data() + layout.atomicMassUncertainty, table.atomicMassUncertainty().data(), count * sizeof(double));
+
+    /* fill in the header */
+    NuclideCacheHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, cacheMagic_, sizeof(header.magic));
+    header.byteOrder = cacheByteOrder_;
+    header.version = NuclideCacheView::version;
+    header.count = static_cast<std::uint32_t>(count);
+    header.payloadSize = layout.fileSize - sizeof(NuclideCacheHeader);
+    header.checksum = checksum(buffer.data() + sizeof(NuclideCacheHeader), header.payloadSize);
+    std::memcpy(buffer.data(), &header, sizeof(header));
+
+    /* never truncate the file in place - a mapping of it would lose its pages */
+    const std::string temporaryName = fileName + ".tmp";
+    std::ofstream out(temporaryName, std::ios::binary | std::ios::trunc);
+    if (!out) return false;
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    out.close();
+    if (!out) {
+        std::remove(temporaryName.c_str());
+        return false;
+    }
+
+    /* rename does not replace an existing file on every platform, so remove the old one first */
+    std::remove(fileName.c_str());
+    if (std::rename(temporaryName.c_str(), fileName.c_str()) != 0) {
+        std::remove(temporaryName.c_str());
+        return false;
+    }
+    return true;
+}
+
+/* validate a buffer and point the view at it */
+bool NuclideCacheView::open(const char *data, std::size_t size)
+{
+    this->data_ = nullptr;
+    this->count_ = 0;
+
+    /* check the header */
+    if (data == nullptr || size < sizeof(NuclideCacheHeader)) return false;
+    NuclideCacheHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, cacheMagic_, sizeof(header.magic)) != 0) return false;
+    if (header.byteOrder != cacheByteOrder_) return false;
+    if (header.version != NuclideCacheView::version) return false;
+
+    /* check the size and contents of the columns */
+    const NuclideCacheLayout layout = NuclideCacheLayout::forCount(header.count);
+    if (layout.fileSize != size) return false;
+    if (header.payloadSize != size - sizeof(NuclideCacheHeader)) return false;
+    if (header.checksum != checksum(data + sizeof(NuclideCacheHeader), header.payloadSize)) return false;
+
+    this->data_ = data;
+    this->count_ = static_cast<int>(header.count);
+    this->layout_ = layout;
+    return true;
+}
+
+/* copy the columns into a nuclide table */
+void NuclideCacheView::copyTo(NuclideTable &table) const
+{
+    table.assign(this->count_, this->neutrons(), this->protons(), this->nucleons(), this->symbols(), this->flags(),
+                        this->bindingEnergy(), this->bindingEnergyUncertainty(),
+                        this->atomicMass(), this->atomicMassUncertainty());
+}
+
+/* point a nuclide table at the columns */
+void NuclideCacheView::attachTo(NuclideTable &table, std::shared_ptr<const void> storage) const
+{
+    table.attach(this->count_, this->neutrons(), this->protons(), this->nucleons(), this->symbols(), this->flags(),
+                 this->bindingEnergy(), this->bindingEnergyUncertainty(),
+                 this->atomicMass(), this->atomicMassUncertainty(), std::move(storage));
+}
@@ -0,0 +1,83 @@
+#ifndef NUCLIDECACHE_H
+#define NUCLIDECACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "nuclidetable.h"
+
+/*
+ * Binary cache of the nuclide table. The file starts with a 64 byte header followed by one
+ * contiguous column per field, each starting on an 8 byte boundary:
+ *   int16 neutrons, int16 protons, int16 nucleons, uint8 symbol id, uint8 flags,
+ *   double binding energy (keV), double uncertainty (keV), double atomic mass (micro-u), double uncertainty (micro-u)
+ * The header carries a version, the byte order and a checksum of the columns so a stale or
+ * damaged file is rejected and the data is re-imported from the csv file or the server.
+ */
+
+/* columns of the cache file in storage order */
+struct NuclideCacheLayout
+{
+    std::size_t neutrons;
+    std::size_t protons;
+    std::size_t nucleons;
+    std::size_t symbols;
+    std::size_t flags;
+    std::size_t bindingEnergy;
+    std::size_t bindingEnergyUncertainty;
+    std::size_t atomicMass;
+    std::size_t atomicMassUncertainty;
+    std::size_t fileSize;
+
+    /* returns the byte offsets of the columns for a given number of nuclides */
+    static NuclideCacheLayout forCount(std::size_t count);
+};
+
+/* writes a nuclide table as a binary cache file */
+class NuclideCacheWriter
+{
+public:
+    /* write the cache file - it is written beside the old one and renamed over it, so a process which has the old
+       file mapped keeps reading the old columns - returns false if it could not be written */
+    static bool write(const std::string &fileName, const NuclideTable &table);
+};
+
+/* read-only view of a cache file held in memory, normally a file mapping */
+class NuclideCacheView
+{
+private:
+    const char *data_ = nullptr;
+    int count_ = 0;
+    NuclideCacheLayout layout_ = NuclideCacheLayout();
+
+    template <typename T>
+    const T *column(std::size_t offset) const { return reinterpret_cast<const T *>(this->data_ + offset); }
+
+public:
+    /* current file format version */
+    static constexpr std::uint32_t version = 1;
+
+    /* validate a buffer and point the view at it - returns false if it is not a valid cache */
+    bool open(const char *data, std::size_t size);
+
+    /* getters for the columns - the pointers are valid while the buffer is */
+    int count() const { return this->count_; }
+    const std::int16_t *neutrons() const { return this->column<std::int16_t>(this->layout_.neutrons); }
+    const std::int16_t *protons() const { return this->column<std::int16_t>(this->layout_.protons); }
+    const std::int16_t *nucleons() const { return this->column<std::int16_t>(this->layout_.nucleons); }
+    const std::uint8_t *symbols() const { return this->column<std::uint8_t>(this->layout_.symbols); }
+    const std::uint8_t *flags() const { return this->column<std::uint8_t>(this->layout_.flags); }
+    const double *bindingEnergy() const { return this->column<double>(this->layout_.bindingEnergy); }
+    const double *bindingEnergyUncertainty() const { return this->column<double>(this->layout_.bindingEnergyUncertainty); }
+    const double *atomicMass() const { return this->column<double>(this->layout_.atomicMass); }
+    const double *atomicMassUncertainty() const { return this->column<double>(this->layout_.atomicMassUncertainty); }
+
+    /* copy the columns into a nuclide table sized to fit them exactly */
+    void copyTo(NuclideTable &table) const;
+
+    /* point a nuclide table at the columns without copying them - storage must keep the buffer alive */
+    void attachTo(NuclideTable &table, std::shared_ptr<const void> storage) const;
+};
+
+#endif // NUCLIDECACHE_H
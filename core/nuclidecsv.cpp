@@ -0,0 +1,81 @@
+#include "nuclidecsv.h"
+
+/* number of comma separated fields on a line */
+static constexpr int numberOfFields_ = 8;
+
+/* first line of files which mark estimated nuclides */
+static constexpr char versionLine_[] = "# nuclear_data.csv 2 - values of estimated nuclides end in #";
+
+/* write the version line */
+void NuclideCsv::writeHeader(std::ostream &out)
+{
+    out << versionLine_ << '\n';
+}
+
+/* true if the file starts with the version line */
+bool NuclideCsv::hasEstimatedMarks(const char *data, std::size_t size)
+{
+    const std::size_t length = sizeof(versionLine_) - 1;
+    return size >= length && std::memcmp(data, versionLine_, length) == 0;
+}
+
+/* parse a single line into a record */
+bool NuclideCsv::parseLine(const char *line, std::size_t length, NuclideRecord &record)
+{
+    /* strip a carriage return left by windows line endings */
+    if (length > 0 && line[length - 1] == '\r') length--;
+
+    /* split the line into fields without copying */
+    const char *begin[numberOfFields_];
+    const char *end[numberOfFields_];
+    const char *lineEnd = line + length;
+    const char *position = line;
+    for (int field = 0; field < numberOfFields_; field++) {
+        if (position > lineEnd) return false;
+        const char *comma = static_cast<const char *>(std::memchr(position, ',', lineEnd - position));
+        begin[field] = position;
+        end[field] = comma ? comma : lineEnd;
+        position = comma ? comma + 1 : lineEnd + 1;
+    }
+
+    /* a header, stray text or a non-numeric value is not a nuclide */
+    for (int field = 0; field < 3; field++) {
+        if (!AmeParser::isIntegerField(begin[field], end[field])) return false;
+    }
+    for (int field = 4; field < numberOfFields_; field++) {
+        if (!AmeParser::isDecimalField(begin[field], end[field])) return false;
+    }
+
+    /* convert the fields */
+    bool estimated = false;
+    bool fieldEstimated;
+    record.neutrons = AmeParser::parseInt(begin[0], end[0]);
+    record.protons = AmeParser::parseInt(begin[1], end[1]);
+    record.nucleons = AmeParser::parseInt(begin[2], end[2]);
+
+    int symbolLength = 0;
+    for (const char *c = begin[3]; c < end[3] && symbolLength < 3; c++) {
+        if (*c != ' ') record.element[symbolLength++] = *c;
+    }
+    record.element[symbolLength] = '\0';
+
+    record.bindingEnergy = AmeParser::parseDouble(begin[4], end[4], fieldEstimated);
+    estimated = estimated || fieldEstimated;
+    record.bindingEnergyUncertainty = AmeParser::parseDouble(begin[5], end[5], fieldEstimated);
+    estimated = estimated || fieldEstimated;
+    record.atomicMass = AmeParser::parseDouble(begin[6], end[6], fieldEstimated);
+    estimated = estimated || fieldEstimated;
+    record.atomicMassUncertainty = AmeParser::parseDouble(begin[7], end[7], fieldEstimated);
+    estimated = estimated || fieldEstimated;
+    record.estimated = estimated;
+    return true;
+}
+
+/* write a nuclide as one line of the csv file - the stream precision should be at least 15 */
+void NuclideCsv::writeLine(std::ostream &out, const NuclideRecord &record)
+{
+    const char *mark = record.estimated ? "#" : "";
+    out << record.neutrons << ',' << record.protons << ',' << record.nucleons << ',' << record.element << ','
+        << record.bindingEnergy << mark << ',' << record.bindingEnergyUncertainty << mark << ','
+        << record.atomicMass << mark << ',' << record.atomicMassUncertainty << mark << '\n';
+}
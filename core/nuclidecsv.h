@@ -0,0 +1,53 @@
+#ifndef NUCLIDECSV_H
+#define NUCLIDECSV_H
+
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include "ameparser.h"
+
+/* reader and writer for the nuclear_data.csv import/export format - one nuclide per line with the fields
+   neutrons, protons, nucleons, symbol, binding energy, uncertainty, atomic mass, uncertainty. The values of
+   estimated nuclides end in '#' as in the AME tables, and files written this way start with a version line */
+class NuclideCsv
+{
+public:
+    /* write the version line - it is not a nuclide, so readers skip it */
+    static void writeHeader(std::ostream &out);
+
+    /* true if the file starts with the version line, i.e. estimated nuclides are marked - older files lost the marks */
+    static bool hasEstimatedMarks(const char *data, std::size_t size);
+
+    /* parse a single line (without the newline) - returns false if the line does not hold a nuclide, i.e. N, Z or A
+       is not an integer or a value is not a number */
+    static bool parseLine(const char *line, std::size_t length, NuclideRecord &record);
+
+    /* parse a whole file held in memory and call sink(record) for every nuclide - returns the number of nuclides */
+    template <typename Sink>
+    static std::size_t parse(const char *data, std::size_t size, Sink sink);
+
+    /* write a nuclide as one line of the csv file, marking the values of an estimated nuclide with '#' */
+    static void writeLine(std::ostream &out, const NuclideRecord &record);
+};
+
+template <typename Sink>
+std::size_t NuclideCsv::parse(const char *data, std::size_t size, Sink sink)
+{
+    const char *position = data;
+    const char *end = data + size;
+    std::size_t count = 0;
+    NuclideRecord record;
+
+    while (position < end) {
+        const char *newline = static_cast<const char *>(std::memchr(position, '\n', end - position));
+        const char *lineEnd = newline ? newline : end;
+        if (parseLine(position, lineEnd - position, record)) {
+            sink(record);
+            count++;
+        }
+        position = newline ? newline + 1 : end;
+    }
+    return count;
+}
+
+#endif // NUCLIDECSV_H
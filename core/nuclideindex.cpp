@@ -0,0 +1,40 @@
+#include "nuclideindex.h"
+#include <algorithm>
+
+/* constructor - the index starts empty */
+NuclideIndex::NuclideIndex()
+    : maxProtons_(-1)
+    , maxNeutrons_(-1)
+{
+}
+
+/* build the index for a table */
+void NuclideIndex::build(const NuclideTable &table)
+{
+    const ColumnSpan<std::int16_t> protons = table.protons();
+    const ColumnSpan<std::int16_t> neutrons = table.neutrons();
+
+    /* size the grid to the largest Z and N in the table */
+    this->maxProtons_ = -1;
+    this->maxNeutrons_ = -1;
+    for (int row = 0; row < table.size(); row++) {
+        this->maxProtons_ = std::max<int>(this->maxProtons_, protons[row]);
+        this->maxNeutrons_ = std::max<int>(this->maxNeutrons_, neutrons[row]);
+    }
+    const std::size_t cells = static_cast<std::size_t>(this->maxProtons_ + 1) * static_cast<std::size_t>(this->maxNeutrons_ + 1);
+    this->rows_.assign(cells, notFound);
+
+    /* the first row wins if a nuclide appears twice */
+    for (int row = table.size() - 1; row >= 0; row--) {
+        if (protons[row] < 0 || neutrons[row] < 0) continue;
+        this->rows_[static_cast<std::size_t>(protons[row]) * (this->maxNeutrons_ + 1) + neutrons[row]] = row;
+    }
+}
+
+/* look up many nuclides at once */
+void NuclideIndex::find(const int *protonNumbers, const int *nucleonNumbers, int *rows, std::size_t count) const
+{
+    for (std::size_t i = 0; i < count; i++) {
+        rows[i] = this->find(protonNumbers[i], nucleonNumbers[i]);
+    }
+}
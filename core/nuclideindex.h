@@ -0,0 +1,49 @@
+#ifndef NUCLIDEINDEX_H
+#define NUCLIDEINDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "nuclidetable.h"
+
+/*
+ * Dense (Z, N) index into a nuclide table. The index is a 2-D grid of row numbers built once after
+ * the table is loaded, so any nuclide is found with a single array read. Cells with no nuclide, and
+ * requests outside the grid, return notFound.
+ */
+class NuclideIndex
+{
+private:
+    std::vector<std::int32_t> rows_;
+    int maxProtons_;
+    int maxNeutrons_;
+
+public:
+    /* returned for nuclides which are not in the table */
+    static constexpr int notFound = -1;
+
+    NuclideIndex();
+
+    /* build the index for a table - call again whenever the table changes */
+    void build(const NuclideTable &table);
+
+    /* returns the table row of a nuclide given by proton and neutron number */
+    int findByNeutrons(int protonNumber, int neutronNumber) const {
+        if (protonNumber < 0 || protonNumber > this->maxProtons_ || neutronNumber < 0 || neutronNumber > this->maxNeutrons_) return notFound;
+        return this->rows_[static_cast<std::size_t>(protonNumber) * (this->maxNeutrons_ + 1) + neutronNumber];
+    }
+
+    /* returns the table row of a nuclide given by proton and nucleon number */
+    int find(int protonNumber, int nucleonNumber) const {
+        return this->findByNeutrons(protonNumber, nucleonNumber - protonNumber);
+    }
+
+    /* look up many nuclides at once - rows[i] is the row of (protonNumbers[i], nucleonNumbers[i]) */
+    void find(const int *protonNumbers, const int *nucleonNumbers, int *rows, std::size_t count) const;
+
+    /* grid extent */
+    int maxProtons() const { return this->maxProtons_; }
+    int maxNeutrons() const { return this->maxNeutrons_; }
+};
+
+#endif // NUCLIDEINDEX_H
@@ -0,0 +1,244 @@
+#include "nuclideloader.h"
+#include "nuclidecache.h"
+#include "nuclidecsv.h"
+#include <QFile>
+#include <fstream>
+
+/* map a file into memory and pass the bytes to parse(data, size) - falls back to reading the file if it cannot be mapped */
+template <typename Parse>
+static bool parseFile(const QString &fileName, Parse parse)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) return false;
+
+    const qint64 size = file.size();
+    uchar *mapped = file.map(0, size);
+    bool parsed;
+    if (mapped) {
+        parsed = parse(reinterpret_cast<const char *>(mapped), size);
+        file.unmap(mapped);
+    } else {
+        QByteArray fileData = file.readAll();
+        parsed = parse(fileData.constData(), static_cast<qint64>(fileData.size()));
+    }
+    file.close();
+    return parsed;
+}
+
+/* constructor */
+NuclideLoader::NuclideLoader(QObject *parent)
+    : QObject(parent)
+    , table_(new NuclideTable)
+{
+}
+
+/* hand the loaded table to the caller */
+std::unique_ptr<NuclideTable> NuclideLoader::takeTable()
+{
+    std::unique_ptr<NuclideTable> table(new NuclideTable);
+    table.swap(this->table_);
+    return table;
+}
+
+/* check if the binary cache or the csv file exists and load or download from server */
+void NuclideLoader::load()
+{
+    if (processDataFromCache("nuclear_data.bin") ||
+        processDataFromFile("nuclear_data.csv") ||
+        processDataFromAmeFile("mass16.txt")) {
+        emit loaded(this->table_->size());
+        return;
+    }
+
+    /* file does not exist - download the table and parse it as it arrives, the manager lives in the loader thread */
+    this->table_->clear();
+    this->streamParser_.reset();
+    QNetworkAccessManager *mNetworkManager = new QNetworkAccessManager(this);
+    QNetworkReply *reply = mNetworkManager->get(QNetworkRequest(NuclideLoader::serverUrl()));
+
+    /* keep only a small window of the reply in memory - the rest waits in the socket until it is parsed */
+    reply->setReadBufferSize(streamBufferSize_ * 4);
+    connect(reply, &QNetworkReply::readyRead, this, &NuclideLoader::onReplyReadyRead);
+    connect(reply, &QNetworkReply::finished, this, &NuclideLoader::onReplyFinished);
+}
+
+/* returns the address of the AME table - ATOMICDATA_AME_URL overrides it, e.g. to use a local server */
+QUrl NuclideLoader::serverUrl()
+{
+    QByteArray url = qgetenv("ATOMICDATA_AME_URL");
+    if (!url.isEmpty()) return QUrl(QString::fromLocal8Bit(url));
+    return QUrl("https://www-nds.iaea.org/amdc/ame2016/mass16.txt");
+}
+
+/* function called as each chunk of the table arrives - parse the complete lines straight away */
+void NuclideLoader::onReplyReadyRead()
+{
+    const int RESPONSE_OK = 200;
+
+    QNetworkReply *reply = qobject_cast<QNetworkReply *>(sender());
+    if (!reply) return;
+
+    /* leave error pages alone, onReplyFinished reports them */
+    int httpstatuscode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toUInt();
+    if (httpstatuscode != RESPONSE_OK) return;
+
+    /* size the table from the content length when the first chunk arrives - it grows if the length is unknown */
+    if (this->table_->empty()) {
+        bool knownLength = false;
+        qlonglong contentLength = reply->header(QNetworkRequest::ContentLengthHeader).toLongLong(&knownLength);
+        if (knownLength && contentLength > 0) {
+            this->table_->reserve(static_cast<int>(this->streamParser_.estimateDataLines(static_cast<std::size_t>(contentLength))));
+        }
+    }
+
+    char buffer[streamBufferSize_];
+    qint64 bytesRead;
+    while ((bytesRead = reply->read(buffer, sizeof(buffer))) > 0) {
+        this->streamParser_.feed(buffer, static_cast<std::size_t>(bytesRead), [this](const NuclideRecord &record) {
+            addNuclide(record);
+        });
+    }
+}
+
+/* function called once the download is complete */
+void NuclideLoader::onReplyFinished()
+{
+    const int RESPONSE_OK = 200;
+    const int RESPONSE_ERROR = 404;
+    const int RESPONSE_BAD_REQUEST = 400;
+
+    QNetworkReply *reply = qobject_cast<QNetworkReply *>(sender());
+    if (!reply) return;
+
+    if(reply->error() == QNetworkReply::NoError)
+    {
+        int httpstatuscode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toUInt();
+        switch(httpstatuscode)
+        {
+        case RESPONSE_OK:
+            // Request accepted and reply has been sent - parse anything left and the last line
+            onReplyReadyRead();
+            this->streamParser_.finish([this](const NuclideRecord &record) {
+                addNuclide(record);
+            });
+            if (this->table_->empty()) {
+                emit failed("The server reply did not hold any nuclides");
+            } else {
+                this->table_->shrinkToFit();
+                writeCaches();
+                emit loaded(this->table_->size());
+            }
+            break;
+        case RESPONSE_ERROR:
+            emit failed("The nuclear data was not found on the server (404)");
+            break;
+        case RESPONSE_BAD_REQUEST:
+            emit failed("The server rejected the request for nuclear data (400)");
+            break;
+        default:
+            emit failed(QString("Unexpected response from the server (%1)").arg(httpstatuscode));
+            break;
+        }
+    } else {
+        emit failed(reply->errorString());
+    }
+    reply->deleteLater();
+}
+
+/* add a nuclide to the table and report progress */
+void NuclideLoader::addNuclide(const NuclideRecord &record)
+{
+    this->table_->append(record);
+    if (this->table_->size() % progressInterval_ == 0) {
+        emit progress(this->table_->size());
+    }
+}
+
+/* function called to parse a local copy of the AME table - the file is memory mapped so no copy is made */
+bool NuclideLoader::processDataFromAmeFile(const QString &fileName)
+{
+    return parseFile(fileName, [this](const char *data, qint64 size) -> bool {
+        processDataFromServer(data, size);
+        return !this->table_->empty();
+    });
+}
+
+/* function called to parse a whole AME table held in memory */
+void NuclideLoader::processDataFromServer(const char *data, qint64 size)
+{
+    /* size the table from the input before parsing */
+    AmeParser parser(AmeFormat::ame2016());
+    this->table_->clear();
+    this->table_->reserve(static_cast<int>(parser.countDataLines(data, static_cast<std::size_t>(size))));
+
+    /* parse the fixed width rows straight into records */
+    parser.parse(data, static_cast<std::size_t>(size), [this](const NuclideRecord &record) {
+        addNuclide(record);
+    });
+    this->table_->shrinkToFit();
+    writeCaches();
+}
+
+/* write the table to the csv file and the binary cache */
+void NuclideLoader::writeCaches() const
+{
+    /* csv file to hold data - numbers are written in the C locale */
+    std::ofstream out("nuclear_data.csv");
+    out.precision(15);
+    NuclideCsv::writeHeader(out);
+    NuclideRecord record;
+    for (int row = 0; row < this->table_->size(); row++) {
+        this->table_->record(row, record);
+        NuclideCsv::writeLine(out, record);
+    }
+    out.close();
+    NuclideCacheWriter::write("nuclear_data.bin", *this->table_);
+}
+
+/* function called to load the binary cache - the table reads its columns straight from the read-only file mapping, which
+   is held until the table is changed or destroyed, so loading only pages in the file */
+bool NuclideLoader::processDataFromCache(const QString &fileName)
+{
+    std::shared_ptr<QFile> file = std::make_shared<QFile>(fileName);
+    if (!file->open(QIODevice::ReadOnly)) return false;
+
+    /* without a mapping the file is read into memory and the columns are copied out of it */
+    const qint64 size = file->size();
+    uchar *mapped = file->map(0, size);
+    QByteArray fileData;
+    if (!mapped) fileData = file->readAll();
+
+    /* check the version and checksum - an invalid cache is ignored and rebuilt from the csv file */
+    NuclideCacheView view;
+    if (mapped) {
+        if (!view.open(reinterpret_cast<const char *>(mapped), static_cast<std::size_t>(size))) return false;
+        view.attachTo(*this->table_, std::shared_ptr<const void>(mapped, [file](uchar *data) { file->unmap(data); }));
+    } else {
+        if (!view.open(fileData.constData(), static_cast<std::size_t>(fileData.size()))) return false;
+        view.copyTo(*this->table_);
+    }
+    emit progress(this->table_->size());
+    return !this->table_->empty();
+}
+
+/* function called if input data exists to get data from file */
+bool NuclideLoader::processDataFromFile(const QString &fileName)
+{
+    return parseFile(fileName, [this](const char *data, qint64 size) -> bool {
+        /* size the table from the input before parsing */
+        this->table_->clear();
+        this->table_->reserve(static_cast<int>(AmeParser::countLines(data, static_cast<std::size_t>(size))));
+
+        /* parse the lines straight into the table */
+        NuclideCsv::parse(data, static_cast<std::size_t>(size), [this](const NuclideRecord &record) {
+            addNuclide(record);
+        });
+        this->table_->shrinkToFit();
+
+        /* write the binary cache so the next start up can map it - but not from an older file without the estimated
+           marks, or the cache would make the missing flags permanent */
+        if (this->table_->empty()) return false;
+        if (NuclideCsv::hasEstimatedMarks(data, static_cast<std::size_t>(size))) NuclideCacheWriter::write("nuclear_data.bin", *this->table_);
+        return true;
+    });
+}
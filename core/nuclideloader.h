@@ -0,0 +1,62 @@
+#ifndef NUCLIDELOADER_H
+#define NUCLIDELOADER_H
+
+#include <QObject>
+#include <QString>
+#include <QUrl>
+#include <QtNetwork/QNetworkReply>
+#include <QtNetwork/QNetworkAccessManager>
+#include <memory>
+#include "ameparser.h"
+#include "nuclidetable.h"
+
+/*
+ * Loads the nuclide table away from the gui thread. The loader is moved to a worker thread and
+ * load() tries, in order, the binary cache, the csv file, a local copy of the AME table and
+ * finally the AME server. The download is parsed line by line as it arrives. Progress is reported
+ * while parsing and loaded() is emitted once the records are ready to be taken by the gui thread.
+ */
+class NuclideLoader : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit NuclideLoader(QObject *parent = nullptr);
+
+    /* hand the loaded table to the caller - only call after loaded() has been emitted */
+    std::unique_ptr<NuclideTable> takeTable();
+
+    /* returns the address the AME table is downloaded from */
+    static QUrl serverUrl();
+
+public slots:
+    void load();
+
+signals:
+    void progress(int nuclides);
+    void loaded(int nuclides);
+    void failed(const QString &message);
+
+private slots:
+    void onReplyReadyRead();
+    void onReplyFinished();
+
+private:
+    std::unique_ptr<NuclideTable> table_;
+    AmeStreamParser streamParser_;
+
+    /* report progress every this many nuclides */
+    static constexpr int progressInterval_ = 256;
+
+    /* size of the chunks read from the network reply */
+    static constexpr int streamBufferSize_ = 4096;
+
+    void addNuclide(const NuclideRecord &record);
+    bool processDataFromCache(const QString &fileName);
+    bool processDataFromFile(const QString &fileName);
+    bool processDataFromAmeFile(const QString &fileName);
+    void processDataFromServer(const char *data, qint64 size);
+    void writeCaches() const;
+};
+
+#endif // NUCLIDELOADER_H
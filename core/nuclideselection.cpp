@@ -0,0 +1,185 @@
+#include "nuclideselection.h"
+#include "elements.h"
+#include "parallel.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <type_traits>
+
+/* stable sort of the rows by a key, with NaN keys last, recording where each run of equal keys starts and where the NaN keys start */
+template <typename T>
+static void sortByColumn(std::vector<int> &permutation, const ColumnSpan<T> &column, std::vector<int> &runStarts, int &nanBegin)
+{
+    std::stable_sort(permutation.begin(), permutation.end(), [&](int a, int b) {
+        const T x = column[a];
+        const T y = column[b];
+        if constexpr (std::is_floating_point_v<T>) {
+            if (std::isnan(x)) return false;
+            if (std::isnan(y)) return true;
+        }
+        return x < y;
+    });
+
+    const int size = static_cast<int>(permutation.size());
+    nanBegin = size;
+    if constexpr (std::is_floating_point_v<T>) {
+        while (nanBegin > 0 && std::isnan(column[permutation[nanBegin - 1]])) nanBegin--;
+    }
+    runStarts.clear();
+    for (int position = 0; position < nanBegin; position++) {
+        if (position == 0 || column[permutation[position - 1]] < column[permutation[position]]) runStarts.push_back(position);
+    }
+}
+
+/* constructor - an empty selection in table order */
+NuclideSelection::NuclideSelection()
+    : nanBegins_()
+    , sortColumn_(ColumnNucleons)
+    , descending_(false)
+    , tableSize_(0)
+{
+}
+
+/* sort every column once - the columns are sorted side by side */
+void NuclideSelection::build(const NuclideTable &table)
+{
+    const int size = table.size();
+    this->tableSize_ = size;
+
+    /* symbols sort alphabetically - rank every symbol id once instead of comparing strings per row */
+    std::uint8_t symbolRanks[numberOfElementSymbols];
+    int bySymbol[numberOfElementSymbols];
+    std::iota(bySymbol, bySymbol + numberOfElementSymbols, 0);
+    std::sort(bySymbol, bySymbol + numberOfElementSymbols, [](int a, int b) {
+        return std::strcmp(elementSymbol(a), elementSymbol(b)) < 0;
+    });
+    for (int rank = 0; rank < numberOfElementSymbols; rank++) symbolRanks[bySymbol[rank]] = static_cast<std::uint8_t>(rank);
+    std::vector<std::uint8_t> symbolKeys(size);
+    const ColumnSpan<std::uint8_t> symbols = table.symbols();
+    for (int row = 0; row < size; row++) symbolKeys[row] = symbols[row] < numberOfElementSymbols ? symbolRanks[symbols[row]] : 0xff;
+
+    parallelFor(numberOfNuclideColumns, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t column = begin; column < end; column++) {
+            std::vector<int> &permutation = this->permutations_[column];
+            std::vector<int> &runStarts = this->runStarts_[column];
+            int &nanBegin = this->nanBegins_[column];
+            permutation.resize(size);
+            std::iota(permutation.begin(), permutation.end(), 0);
+            switch (column) {
+            case ColumnNeutrons: sortByColumn(permutation, table.neutrons(), runStarts, nanBegin); break;
+            case ColumnProtons: sortByColumn(permutation, table.protons(), runStarts, nanBegin); break;
+            case ColumnNucleons: sortByColumn(permutation, table.nucleons(), runStarts, nanBegin); break;
+            case ColumnSymbol: sortByColumn(permutation, ColumnSpan<std::uint8_t>(symbolKeys.data(), size), runStarts, nanBegin); break;
+            case ColumnBindingEnergy: sortByColumn(permutation, table.bindingEnergy(), runStarts, nanBegin); break;
+            case ColumnBindingEnergyUncertainty: sortByColumn(permutation, table.bindingEnergyUncertainty(), runStarts, nanBegin); break;
+            case ColumnAtomicMass: sortByColumn(permutation, table.atomicMass(), runStarts, nanBegin); break;
+            case ColumnAtomicMassUncertainty: sortByColumn(permutation, table.atomicMassUncertainty(), runStarts, nanBegin); break;
+            }
+        }
+    }, 1);
+
+    this->mask_.assign(size, 1);
+    this->sortColumn_ = ColumnNucleons;
+    this->descending_ = false;
+    this->select();
+}
+
+/* forget the table */
+void NuclideSelection::clear()
+{
+    for (std::vector<int> &permutation : this->permutations_) permutation.clear();
+    for (std::vector<int> &runStarts : this->runStarts_) runStarts.clear();
+    std::fill(this->nanBegins_, this->nanBegins_ + numberOfNuclideColumns, 0);
+    this->mask_.clear();
+    this->rows_.clear();
+    this->tableSize_ = 0;
+}
+
+/* change the order - no comparisons, just a walk of the stored permutation */
+void NuclideSelection::sort(NuclideColumn column, bool descending)
+{
+    if (column < 0 || column >= numberOfNuclideColumns) return;
+    this->sortColumn_ = column;
+    this->descending_ = descending;
+    this->select();
+}
+
+/* evaluate the filter for every row in one branch free pass over the columns */
+void NuclideSelection::filter(const NuclideTable &table, const NuclideFilter &filter)
+{
+    const int size = table.size();
+    if (size != this->tableSize_) return;
+
+    const std::int16_t *protons = table.protons().data();
+    const std::int16_t *neutrons = table.neutrons().data();
+    const std::int16_t *nucleons = table.nucleons().data();
+    const std::uint8_t *symbols = table.symbols().data();
+    const std::uint8_t *flags = table.flags().data();
+    const double *bindingEnergy = table.bindingEnergy().data();
+    std::uint8_t *mask = this->mask_.data();
+
+    /* clamp the integer ranges to the column type so the comparisons stay 16 bit */
+    auto clamp16 = [](int value) { return static_cast<std::int16_t>(std::clamp(value, -32768, 32767)); };
+    const std::int16_t minimumProtons = clamp16(filter.minimumProtons);
+    const std::int16_t maximumProtons = clamp16(filter.maximumProtons);
+    const std::int16_t minimumNeutrons = clamp16(filter.minimumNeutrons);
+    const std::int16_t maximumNeutrons = clamp16(filter.maximumNeutrons);
+    const std::int16_t minimumNucleons = clamp16(filter.minimumNucleons);
+    const std::int16_t maximumNucleons = clamp16(filter.maximumNucleons);
+    const double minimumBindingEnergy = filter.minimumBindingEnergy;
+    const double maximumBindingEnergy = filter.maximumBindingEnergy;
+    const bool anyElement = filter.element < 0;
+    const std::uint8_t element = static_cast<std::uint8_t>(filter.element);
+    const std::uint8_t excludedFlags = filter.excludedFlags;
+
+    /* a NaN binding energy only fails a range which has been set */
+    #pragma omp simd
+    for (int row = 0; row < size; row++) {
+        mask[row] = (protons[row] >= minimumProtons) & (protons[row] <= maximumProtons)
+                  & (neutrons[row] >= minimumNeutrons) & (neutrons[row] <= maximumNeutrons)
+                  & (nucleons[row] >= minimumNucleons) & (nucleons[row] <= maximumNucleons)
+                  & !(bindingEnergy[row] < minimumBindingEnergy) & !(bindingEnergy[row] > maximumBindingEnergy)
+                  & (anyElement | (symbols[row] == element))
+                  & ((flags[row] & excludedFlags) == 0);
+    }
+    this->select();
+}
+
+/* compact the permutation through the mask - every row is written and only kept ones advance the cursor */
+void NuclideSelection::select()
+{
+    const std::vector<int> &permutation = this->permutations_[this->sortColumn_];
+    const int size = static_cast<int>(permutation.size());
+    const std::uint8_t *mask = this->mask_.data();
+
+    this->rows_.resize(size);
+    int *rows = this->rows_.data();
+    int kept = 0;
+    if (this->descending_) {
+        /* runs of equal keys from the last to the first, each walked forwards so ties keep table order, then the NaN keys */
+        const std::vector<int> &runStarts = this->runStarts_[this->sortColumn_];
+        const int nanBegin = this->nanBegins_[this->sortColumn_];
+        int runEnd = nanBegin;
+        for (int run = static_cast<int>(runStarts.size()) - 1; run >= 0; run--) {
+            for (int position = runStarts[run]; position < runEnd; position++) {
+                const int row = permutation[position];
+                rows[kept] = row;
+                kept += mask[row];
+            }
+            runEnd = runStarts[run];
+        }
+        for (int position = nanBegin; position < size; position++) {
+            const int row = permutation[position];
+            rows[kept] = row;
+            kept += mask[row];
+        }
+    } else {
+        for (int position = 0; position < size; position++) {
+            const int row = permutation[position];
+            rows[kept] = row;
+            kept += mask[row];
+        }
+    }
+    this->rows_.resize(kept);
+}
@@ -0,0 +1,85 @@
+#ifndef NUCLIDESELECTION_H
+#define NUCLIDESELECTION_H
+
+#include <climits>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "nuclidetable.h"
+
+/* columns of the nuclide table a view can show and sort by */
+enum NuclideColumn
+{
+    ColumnNeutrons,
+    ColumnProtons,
+    ColumnNucleons,
+    ColumnSymbol,
+    ColumnBindingEnergy,
+    ColumnBindingEnergyUncertainty,
+    ColumnAtomicMass,
+    ColumnAtomicMassUncertainty,
+    numberOfNuclideColumns
+};
+
+/* ranges a nuclide must fall inside to be shown - the defaults accept every nuclide */
+struct NuclideFilter
+{
+    int minimumProtons = 0;
+    int maximumProtons = INT_MAX;
+    int minimumNeutrons = 0;
+    int maximumNeutrons = INT_MAX;
+    int minimumNucleons = 0;
+    int maximumNucleons = INT_MAX;
+    double minimumBindingEnergy = -std::numeric_limits<double>::infinity();    // keV per nucleon
+    double maximumBindingEnergy = std::numeric_limits<double>::infinity();
+    int element = -1;                       // symbol id, -1 for any element
+    std::uint8_t excludedFlags = 0;         // nuclides with any of these NuclideFlags are hidden
+};
+
+/*
+ * Sorted and filtered list of rows for a table view. Every sort order is computed once in build()
+ * as a permutation of the table rows, along with where each run of equal keys starts, so choosing
+ * a column only walks a permutation. Filtering runs one vectorised pass over the columns into a
+ * mask, and the visible rows are the permutation with the masked rows dropped. Re-sorting or
+ * re-filtering is therefore linear in the table size and never compares a value or a string again.
+ * Ties keep table order and NaN values come last in either direction.
+ */
+class NuclideSelection
+{
+private:
+    std::vector<int> permutations_[numberOfNuclideColumns];
+    std::vector<int> runStarts_[numberOfNuclideColumns];    // first position of each run of equal keys before the NaN keys
+    int nanBegins_[numberOfNuclideColumns];                 // first position with a NaN key
+    std::vector<std::uint8_t> mask_;
+    std::vector<int> rows_;
+    NuclideColumn sortColumn_;
+    bool descending_;
+    int tableSize_;
+
+    /* rebuild the visible rows from the current permutation and mask */
+    void select();
+
+public:
+    NuclideSelection();
+
+    /* compute the sort order of every column and show every row in table order */
+    void build(const NuclideTable &table);
+
+    /* forget the table */
+    void clear();
+
+    /* order the visible rows by a column */
+    void sort(NuclideColumn column, bool descending = false);
+
+    /* show only the rows accepted by the filter, keeping the current order */
+    void filter(const NuclideTable &table, const NuclideFilter &filter);
+
+    NuclideColumn sortColumn() const { return this->sortColumn_; }
+    bool descending() const { return this->descending_; }
+
+    /* table rows in display order */
+    const std::vector<int> &rows() const { return this->rows_; }
+    int size() const { return static_cast<int>(this->rows_.size()); }
+    int row(int position) const { return this->rows_[position]; }
+};
+#endif // NUCLIDESELECTION_H
@@ -0,0 +1,185 @@
+#include "nuclidetable.h"
+#include <algorithm>
+#include <cstring>
+
+/* rounds a byte count up to the column alignment */
+static inline std::size_t alignColumn(std::size_t bytes, std::size_t alignment)
+{
+    return (bytes + alignment - 1) & ~(alignment - 1);
+}
+
+/* constructor - the table starts empty with room for capacity nuclides */
+NuclideTable::NuclideTable(int capacity)
+    : neutrons_(nullptr)
+    , protons_(nullptr)
+    , nucleons_(nullptr)
+    , symbols_(nullptr)
+    , flags_(nullptr)
+    , bindingEnergy_(nullptr)
+    , bindingEnergyUncertainty_(nullptr)
+    , atomicMass_(nullptr)
+    , atomicMassUncertainty_(nullptr)
+    , size_(0)
+    , capacity_(0)
+{
+    if (capacity > 0) this->reallocate(capacity);
+}
+
+/* move the columns into a new arena holding exactly capacity rows */
+void NuclideTable::reallocate(int capacity)
+{
+    const std::size_t rows = static_cast<std::size_t>(capacity);
+    const std::size_t int16Column = alignColumn(rows * sizeof(std::int16_t), columnAlignment_);
+    const std::size_t uint8Column = alignColumn(rows * sizeof(std::uint8_t), columnAlignment_);
+    const std::size_t doubleColumn = alignColumn(rows * sizeof(double), columnAlignment_);
+    const std::size_t arenaSize = 3 * int16Column + 2 * uint8Column + 4 * doubleColumn;
+
+    std::unique_ptr<unsigned char, ArenaDeleter> arena;
+    if (arenaSize > 0) {
+        arena.reset(static_cast<unsigned char *>(::operator new(arenaSize, std::align_val_t(columnAlignment_))));
+    }
+
+    /* carve the columns out of the arena */
+    unsigned char *position = arena.get();
+    std::int16_t *neutrons = reinterpret_cast<std::int16_t *>(position);                  position += int16Column;
+    std::int16_t *protons = reinterpret_cast<std::int16_t *>(position);                   position += int16Column;
+    std::int16_t *nucleons = reinterpret_cast<std::int16_t *>(position);                  position += int16Column;
+    std::uint8_t *symbols = reinterpret_cast<std::uint8_t *>(position);                   position += uint8Column;
+    std::uint8_t *flags = reinterpret_cast<std::uint8_t *>(position);                     position += uint8Column;
+    double *bindingEnergy = reinterpret_cast<double *>(position);                         position += doubleColumn;
+    double *bindingEnergyUncertainty = reinterpret_cast<double *>(position);              position += doubleColumn;
+    double *atomicMass = reinterpret_cast<double *>(position);                            position += doubleColumn;
+    double *atomicMassUncertainty = reinterpret_cast<double *>(position);
+
+    /* keep the rows which still fit */
+    const int keep = std::min(this->size_, capacity);
+    if (keep > 0) {
+        std::memcpy(neutrons, this->neutrons_, keep * sizeof(std::int16_t));
+        std::memcpy(protons, this->protons_, keep * sizeof(std::int16_t));
+        std::memcpy(nucleons, this->nucleons_, keep * sizeof(std::int16_t));
+        std::memcpy(symbols, this->symbols_, keep * sizeof(std::uint8_t));
+        std::memcpy(flags, this->flags_, keep * sizeof(std::uint8_t));
+        std::memcpy(bindingEnergy, this->bindingEnergy_, keep * sizeof(double));
+        std::memcpy(bindingEnergyUncertainty, this->bindingEnergyUncertainty_, keep * sizeof(double));
+        std::memcpy(atomicMass, this->atomicMass_, keep * sizeof(double));
+        std::memcpy(atomicMassUncertainty, this->atomicMassUncertainty_, keep * sizeof(double));
+    }
+
+    this->arena_ = std::move(arena);
+    this->storage_.reset();
+    this->neutrons_ = neutrons;
+    this->protons_ = protons;
+    this->nucleons_ = nucleons;
+    this->symbols_ = symbols;
+    this->flags_ = flags;
+    this->bindingEnergy_ = bindingEnergy;
+    this->bindingEnergyUncertainty_ = bindingEnergyUncertainty;
+    this->atomicMass_ = atomicMass;
+    this->atomicMassUncertainty_ = atomicMassUncertainty;
+    this->size_ = keep;
+    this->capacity_ = capacity;
+}
+
+/* make room for at least capacity nuclides */
+void NuclideTable::reserve(int capacity)
+{
+    if (capacity > this->capacity_) this->reallocate(capacity);
+}
+
+/* release any room which was reserved but not used */
+void NuclideTable::shrinkToFit()
+{
+    if (this->capacity_ != this->size_) this->reallocate(this->size_);
+}
+
+/* add a nuclide to the end of the table */
+void NuclideTable::append(const NuclideRecord &record, std::uint8_t extraFlags)
+{
+    /* grow geometrically when the input size was not known up front - attached columns are read-only, so they are
+       copied first */
+    if (this->size_ >= this->capacity_) this->reallocate(std::max(256, this->capacity_ * 2));
+    else if (this->storage_) this->reallocate(this->capacity_);
+
+    /* unknown symbols fall back to the symbol of the proton number */
+    int symbolId = elementSymbolId(record.element);
+    if (symbolId < 0) symbolId = record.protons;
+
+    const int row = this->size_;
+    this->neutrons_[row] = static_cast<std::int16_t>(record.neutrons);
+    this->protons_[row] = static_cast<std::int16_t>(record.protons);
+    this->nucleons_[row] = static_cast<std::int16_t>(record.nucleons);
+    this->symbols_[row] = static_cast<std::uint8_t>(symbolId);
+    this->flags_[row] = static_cast<std::uint8_t>((record.estimated ? NuclideEstimated : 0) | extraFlags);
+    this->bindingEnergy_[row] = record.bindingEnergy;
+    this->bindingEnergyUncertainty_[row] = record.bindingEnergyUncertainty;
+    this->atomicMass_[row] = record.atomicMass;
+    this->atomicMassUncertainty_[row] = record.atomicMassUncertainty;
+    this->size_++;
+}
+
+/* copy whole columns into the table */
+void NuclideTable::assign(int count, const std::int16_t *neutrons, const std::int16_t *protons, const std::int16_t *nucleons,
+                          const std::uint8_t *symbols, const std::uint8_t *flags,
+                          const double *bindingEnergy, const double *bindingEnergyUncertainty,
+                          const double *atomicMass, const double *atomicMassUncertainty)
+{
+    /* replace the arena with one of exactly the right size */
+    this->size_ = 0;
+    if (count != this->capacity_ || this->storage_) this->reallocate(count);
+    if (count <= 0) return;
+
+    std::memcpy(this->neutrons_, neutrons, count * sizeof(std::int16_t));
+    std::memcpy(this->protons_, protons, count * sizeof(std::int16_t));
+    std::memcpy(this->nucleons_, nucleons, count * sizeof(std::int16_t));
+    std::memcpy(this->symbols_, symbols, count * sizeof(std::uint8_t));
+    std::memcpy(this->flags_, flags, count * sizeof(std::uint8_t));
+    std::memcpy(this->bindingEnergy_, bindingEnergy, count * sizeof(double));
+    std::memcpy(this->bindingEnergyUncertainty_, bindingEnergyUncertainty, count * sizeof(double));
+    std::memcpy(this->atomicMass_, atomicMass, count * sizeof(double));
+    std::memcpy(this->atomicMassUncertainty_, atomicMassUncertainty, count * sizeof(double));
+    this->size_ = count;
+}
+
+/* read the table from columns held by storage - the pointers are only read until reallocate copies them */
+void NuclideTable::attach(int count, const std::int16_t *neutrons, const std::int16_t *protons, const std::int16_t *nucleons,
+                          const std::uint8_t *symbols, const std::uint8_t *flags,
+                          const double *bindingEnergy, const double *bindingEnergyUncertainty,
+                          const double *atomicMass, const double *atomicMassUncertainty, std::shared_ptr<const void> storage)
+{
+    this->arena_.reset();
+    this->storage_ = std::move(storage);
+    this->neutrons_ = const_cast<std::int16_t *>(neutrons);
+    this->protons_ = const_cast<std::int16_t *>(protons);
+    this->nucleons_ = const_cast<std::int16_t *>(nucleons);
+    this->symbols_ = const_cast<std::uint8_t *>(symbols);
+    this->flags_ = const_cast<std::uint8_t *>(flags);
+    this->bindingEnergy_ = const_cast<double *>(bindingEnergy);
+    this->bindingEnergyUncertainty_ = const_cast<double *>(bindingEnergyUncertainty);
+    this->atomicMass_ = const_cast<double *>(atomicMass);
+    this->atomicMassUncertainty_ = const_cast<double *>(atomicMassUncertainty);
+    this->size_ = count;
+    this->capacity_ = count;
+}
+
+/* copy one nuclide out of the columns */
+void NuclideTable::record(int row, NuclideRecord &record) const
+{
+    record.neutrons = this->neutrons_[row];
+    record.protons = this->protons_[row];
+    record.nucleons = this->nucleons_[row];
+    std::strncpy(record.element, this->element(row), sizeof(record.element) - 1);
+    record.element[sizeof(record.element) - 1] = '\0';
+    record.bindingEnergy = this->bindingEnergy_[row];
+    record.bindingEnergyUncertainty = this->bindingEnergyUncertainty_[row];
+    record.atomicMass = this->atomicMass_[row];
+    record.atomicMassUncertainty = this->atomicMassUncertainty_[row];
+    record.estimated = (this->flags_[row] & NuclideEstimated) != 0;
+}
+
+/* returns an atom for the scalar calculations */
+Atom NuclideTable::atom(int row) const
+{
+    return Atom(this->neutrons_[row], this->protons_[row], this->nucleons_[row], this->element(row),
+                this->bindingEnergy_[row], this->bindingEnergyUncertainty_[row],
+                this->atomicMass_[row], this->atomicMassUncertainty_[row]);
+}
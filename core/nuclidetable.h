@@ -0,0 +1,194 @@
+#ifndef NUCLIDETABLE_H
+#define NUCLIDETABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include "ameparser.h"
+#include "atom.h"
+#include "elements.h"
+
+/* flags stored per nuclide */
+enum NuclideFlags : std::uint8_t
+{
+    NuclideEstimated = 0x01,    // value marked with '#' in the AME table
+    NuclideExtrapolated = 0x02  // value predicted by the Garvey-Kelson extrapolation, not in the AME table
+};
+
+/* read-only view of a contiguous column */
+template <typename T>
+class ColumnSpan
+{
+private:
+    const T *data_;
+    int size_;
+
+public:
+    ColumnSpan(const T *data, int size) : data_(data), size_(size) {}
+
+    const T *data() const { return this->data_; }
+    int size() const { return this->size_; }
+    const T *begin() const { return this->data_; }
+    const T *end() const { return this->data_ + this->size_; }
+    const T &operator[](int index) const { return this->data_[index]; }
+};
+
+class NuclideTable;
+
+/* lightweight reference to one row of a nuclide table */
+class NuclideRow
+{
+private:
+    const NuclideTable *table_;
+    int row_;
+
+public:
+    NuclideRow(const NuclideTable *table, int row) : table_(table), row_(row) {}
+
+    int index() const { return this->row_; }
+    inline int getNeutrons() const;
+    inline int getProtons() const;
+    inline int getNucleons() const;
+    inline const char *getElement() const;
+    inline double getBindingEnergy() const;
+    inline double getBindingEnergyUncertainty() const;
+    inline double getAtomicMass() const;
+    inline double getAtomicMassUncertainty() const;
+    inline bool isEstimated() const;
+    inline bool isExtrapolated() const;
+
+    /* returns an atom for the scalar calculations */
+    inline Atom toAtom() const;
+};
+
+/*
+ * Nuclide store laid out as a struct of arrays. Every field lives in its own contiguous, cache line
+ * aligned column so bulk passes only touch the columns they need. All columns share one allocation
+ * sized from the input, so memory follows the dataset and any AME edition fits. A table attached to
+ * read-only columns, such as the mapped binary cache, reads them in place and only copies them into
+ * an allocation of its own when it is changed. Element symbols are interned as
+ * ids into the element table. Masses are kept in micro-u and binding energies in keV per nucleon,
+ * the units of the AME tables.
+ */
+class NuclideTable
+{
+private:
+    /* alignment of every column */
+    static constexpr std::size_t columnAlignment_ = 64;
+
+    /* frees the arena allocated with the column alignment */
+    struct ArenaDeleter
+    {
+        void operator()(unsigned char *arena) const { ::operator delete(arena, std::align_val_t(columnAlignment_)); }
+    };
+
+    /* one allocation holds every column - or, for an attached table, storage_ keeps the read-only columns alive */
+    std::unique_ptr<unsigned char, ArenaDeleter> arena_;
+    std::shared_ptr<const void> storage_;
+    std::int16_t *neutrons_;
+    std::int16_t *protons_;
+    std::int16_t *nucleons_;
+    std::uint8_t *symbols_;
+    std::uint8_t *flags_;
+    double *bindingEnergy_;
+    double *bindingEnergyUncertainty_;
+    double *atomicMass_;
+    double *atomicMassUncertainty_;
+    int size_;
+    int capacity_;
+
+    /* move the columns into a new arena holding exactly capacity rows */
+    void reallocate(int capacity);
+
+public:
+    /* create a table with room for capacity nuclides - the table grows when more are appended */
+    explicit NuclideTable(int capacity = 0);
+
+    /* tables own their arena and are passed around by pointer */
+    NuclideTable(const NuclideTable &) = delete;
+    NuclideTable &operator=(const NuclideTable &) = delete;
+
+    /* make room for at least capacity nuclides - size the table from the input before filling it */
+    void reserve(int capacity);
+
+    /* release any room which was reserved but not used */
+    void shrinkToFit();
+
+    int capacity() const { return this->capacity_; }
+
+    /* remove every nuclide */
+    void clear() { this->size_ = 0; }
+
+    /* add a nuclide to the end of the table, growing it if it is full - extraFlags are set as well as NuclideEstimated */
+    void append(const NuclideRecord &record, std::uint8_t extraFlags = 0);
+
+    /* copy whole columns into the table, e.g. from the binary cache */
+    void assign(int count, const std::int16_t *neutrons, const std::int16_t *protons, const std::int16_t *nucleons,
+                const std::uint8_t *symbols, const std::uint8_t *flags,
+                const double *bindingEnergy, const double *bindingEnergyUncertainty,
+                const double *atomicMass, const double *atomicMassUncertainty);
+
+    /* read the table from columns held by storage, e.g. a mapping of the binary cache, without copying them - the
+       columns must stay unchanged while storage is held, and are copied the first time the table is changed */
+    void attach(int count, const std::int16_t *neutrons, const std::int16_t *protons, const std::int16_t *nucleons,
+                const std::uint8_t *symbols, const std::uint8_t *flags,
+                const double *bindingEnergy, const double *bindingEnergyUncertainty,
+                const double *atomicMass, const double *atomicMassUncertainty, std::shared_ptr<const void> storage);
+
+    /* copy one nuclide out of the columns */
+    void record(int row, NuclideRecord &record) const;
+
+    int size() const { return this->size_; }
+    bool empty() const { return this->size_ == 0; }
+
+    /* column accessors */
+    ColumnSpan<std::int16_t> neutrons() const { return ColumnSpan<std::int16_t>(this->neutrons_, this->size_); }
+    ColumnSpan<std::int16_t> protons() const { return ColumnSpan<std::int16_t>(this->protons_, this->size_); }
+    ColumnSpan<std::int16_t> nucleons() const { return ColumnSpan<std::int16_t>(this->nucleons_, this->size_); }
+    ColumnSpan<std::uint8_t> symbols() const { return ColumnSpan<std::uint8_t>(this->symbols_, this->size_); }
+    ColumnSpan<std::uint8_t> flags() const { return ColumnSpan<std::uint8_t>(this->flags_, this->size_); }
+    ColumnSpan<double> bindingEnergy() const { return ColumnSpan<double>(this->bindingEnergy_, this->size_); }
+    ColumnSpan<double> bindingEnergyUncertainty() const { return ColumnSpan<double>(this->bindingEnergyUncertainty_, this->size_); }
+    ColumnSpan<double> atomicMass() const { return ColumnSpan<double>(this->atomicMass_, this->size_); }
+    ColumnSpan<double> atomicMassUncertainty() const { return ColumnSpan<double>(this->atomicMassUncertainty_, this->size_); }
+
+    /* returns the element symbol of a row */
+    const char *element(int row) const { return elementSymbol(this->symbols_[row]); }
+
+    /* row access */
+    NuclideRow row(int row) const { return NuclideRow(this, row); }
+    Atom atom(int row) const;
+
+    /* iterator over the rows */
+    class const_iterator
+    {
+    private:
+        const NuclideTable *table_;
+        int row_;
+
+    public:
+        const_iterator(const NuclideTable *table, int row) : table_(table), row_(row) {}
+        NuclideRow operator*() const { return NuclideRow(this->table_, this->row_); }
+        const_iterator &operator++() { this->row_++; return *this; }
+        bool operator==(const const_iterator &other) const { return this->row_ == other.row_; }
+        bool operator!=(const const_iterator &other) const { return this->row_ != other.row_; }
+    };
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, this->size_); }
+};
+
+/* row getters read straight from the columns */
+inline int NuclideRow::getNeutrons() const { return this->table_->neutrons()[this->row_]; }
+inline int NuclideRow::getProtons() const { return this->table_->protons()[this->row_]; }
+inline int NuclideRow::getNucleons() const { return this->table_->nucleons()[this->row_]; }
+inline const char *NuclideRow::getElement() const { return this->table_->element(this->row_); }
+inline double NuclideRow::getBindingEnergy() const { return this->table_->bindingEnergy()[this->row_]; }
+inline double NuclideRow::getBindingEnergyUncertainty() const { return this->table_->bindingEnergyUncertainty()[this->row_]; }
+inline double NuclideRow::getAtomicMass() const { return this->table_->atomicMass()[this->row_]; }
+inline double NuclideRow::getAtomicMassUncertainty() const { return this->table_->atomicMassUncertainty()[this->row_]; }
+inline bool NuclideRow::isEstimated() const { return (this->table_->flags()[this->row_] & NuclideEstimated) != 0; }
+inline bool NuclideRow::isExtrapolated() const { return (this->table_->flags()[this->row_] & NuclideExtrapolated) != 0; }
+inline Atom NuclideRow::toAtom() const { return this->table_->atom(this->row_); }
+
+#endif // NUCLIDETABLE_H
@@ -0,0 +1,71 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+/* returns the number of worker threads to use - every core unless threads is given */
+inline unsigned parallelThreadCount(unsigned threads = 0)
+{
+    if (threads > 0) return threads;
+    const unsigned cores = std::thread::hardware_concurrency();
+    return cores > 0 ? cores : 1;
+}
+
+/*
+ * Run function(begin, end) over the range [0, count) split into one contiguous block per thread.
+ * The calling thread works on the first block. Ranges shorter than minimumBlock per thread use
+ * fewer threads, so small jobs run on the calling thread without starting any. The function must
+ * only write to the part of the output belonging to its block.
+ */
+template <typename Function>
+void parallelFor(std::size_t count, Function function, std::size_t minimumBlock = 1024, unsigned threads = 0)
+{
+    if (count == 0) return;
+    std::size_t blocks = std::min<std::size_t>(parallelThreadCount(threads), (count + minimumBlock - 1) / std::max<std::size_t>(minimumBlock, 1));
+    if (blocks <= 1) {
+        function(std::size_t(0), count);
+        return;
+    }
+
+    /* spread the remainder over the first blocks */
+    const std::size_t blockSize = count / blocks;
+    const std::size_t remainder = count % blocks;
+    std::vector<std::thread> workers;
+    workers.reserve(blocks - 1);
+    std::size_t begin = blockSize + (remainder > 0 ? 1 : 0);
+    for (std::size_t block = 1; block < blocks; block++) {
+        const std::size_t end = begin + blockSize + (block < remainder ? 1 : 0);
+        workers.emplace_back(function, begin, end);
+        begin = end;
+    }
+    function(std::size_t(0), blockSize + (remainder > 0 ? 1 : 0));
+    for (std::thread &worker : workers) worker.join();
+}
+
+/*
+ * Reduce the range [0, count) in parallel. The range is cut into chunks of chunkSize, each chunk is
+ * mapped with map(begin, end) to a partial result, and the partials are combined in chunk order with
+ * combine(total, partial). The chunks do not depend on the number of threads, so the result is the
+ * same, bit for bit, however many cores run it.
+ */
+template <typename T, typename Map, typename Combine>
+T parallelReduce(std::size_t count, T identity, Map map, Combine combine, std::size_t chunkSize = 1024, unsigned threads = 0)
+{
+    chunkSize = std::max<std::size_t>(chunkSize, 1);
+    const std::size_t chunks = (count + chunkSize - 1) / chunkSize;
+    std::vector<T> partials(chunks, identity);
+    parallelFor(chunks, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t chunk = begin; chunk < end; chunk++) {
+            partials[chunk] = map(chunk * chunkSize, std::min(count, (chunk + 1) * chunkSize));
+        }
+    }, 1, threads);
+
+    T total = identity;
+    for (const T &partial : partials) combine(total, partial);
+    return total;
+}
+
+#endif // PARALLEL_H
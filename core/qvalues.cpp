@@ -0,0 +1,169 @@
+#include "qvalues.h"
+#include "parallel.h"
+#include <cctype>
+#include <cstring>
+#include <cmath>
+#include <limits>
+
+/* Q-values for a list are spread over the cores in blocks of at least this many candidates */
+static constexpr std::size_t minimumBlock_ = 4096;
+
+/* returns the reaction describing a decay mode */
+Reaction Reaction::decay(DecayMode mode)
+{
+    switch (mode) {
+    case DecayAlpha: return Reaction{{0, 0}, {2, 4}, 0};
+    case DecayBetaMinus: return Reaction{{0, 0}, {-1, 0}, 0};
+    case DecayBetaPlus: return Reaction{{0, 0}, {1, 0}, 2};
+    case DecayElectronCapture: return Reaction{{-1, 0}, {0, 0}, 0};
+    default: return Reaction{{0, 0}, {0, 0}, 0};
+    }
+}
+
+/* read one particle symbol */
+static bool parseParticle(const char *begin, const char *end, ReactionParticle &particle)
+{
+    while (begin < end && std::isspace(static_cast<unsigned char>(*begin))) begin++;
+    while (end > begin && std::isspace(static_cast<unsigned char>(*(end - 1)))) end--;
+    if (end - begin != 1) return false;
+    switch (std::tolower(static_cast<unsigned char>(*begin))) {
+    case 'g': particle = {0, 0}; return true;
+    case 'n': particle = {0, 1}; return true;
+    case 'p': particle = {1, 1}; return true;
+    case 'd': particle = {1, 2}; return true;
+    case 't': particle = {1, 3}; return true;
+    case 'h': particle = {2, 3}; return true;
+    case 'a': particle = {2, 4}; return true;
+    default: return false;
+    }
+}
+
+/* read a reaction written as "(n,g)" or "p,n" */
+bool Reaction::parse(const char *text, Reaction &reaction)
+{
+    const char *begin = text;
+    const char *end = text + std::strlen(text);
+    while (begin < end && std::isspace(static_cast<unsigned char>(*begin))) begin++;
+    while (end > begin && std::isspace(static_cast<unsigned char>(*(end - 1)))) end--;
+    if (begin < end && *begin == '(' && *(end - 1) == ')') { begin++; end--; }
+
+    const char *comma = static_cast<const char *>(std::memchr(begin, ',', end - begin));
+    if (!comma) return false;
+    reaction.electronMasses = 0;
+    return parseParticle(begin, comma, reaction.projectile) && parseParticle(comma + 1, end, reaction.ejectile);
+}
+
+/* constructor */
+QValueCalculator::QValueCalculator(const NuclideTable &table, const NuclideIndex &index)
+    : table_(table)
+    , index_(index)
+{
+}
+
+/* row of a light particle - photons and electrons add nothing to the atomic masses */
+bool QValueCalculator::particleRow(const ReactionParticle &particle, int &row) const
+{
+    row = masslessRow_;
+    if (particle.nucleons == 0) return true;
+    row = this->index_.find(particle.protons, particle.nucleons);
+    return row != NuclideIndex::notFound;
+}
+
+/* the light particles of one reaction and their mass balance */
+template <typename Constants>
+QValueCalculator::Particles QValueCalculator::particles(const Reaction &reaction) const
+{
+    const double *atomicMass = this->table_.atomicMass().data();
+    Particles particles = {};
+    particles.found = this->particleRow(reaction.projectile, particles.projectile) && this->particleRow(reaction.ejectile, particles.ejectile);
+    if (particles.found) {
+        const double projectileMass = particles.projectile != masslessRow_ ? atomicMass[particles.projectile] : 0;
+        const double ejectileMass = particles.ejectile != masslessRow_ ? atomicMass[particles.ejectile] : 0;
+        particles.mass = projectileMass - ejectileMass - reaction.electronMasses * (Constants::electronMass * 1.0e6);
+    }
+    return particles;
+}
+
+/* Q-value of one candidate */
+template <typename Constants>
+void QValueCalculator::candidate(const Reaction &reaction, const Particles &particles, int protons, int nucleons,
+                                 double &qValue, double *uncertainty) const
+{
+    const double *atomicMass = this->table_.atomicMass().data();
+    const double *atomicMassUncertainty = this->table_.atomicMassUncertainty().data();
+
+    /* micro-u to keV */
+    const double scale = 1.0e-6 * Constants::amutokeV;
+
+    const int target = this->index_.find(protons, nucleons);
+    const int residual = this->index_.find(protons + reaction.projectile.protons - reaction.ejectile.protons,
+                                           nucleons + reaction.projectile.nucleons - reaction.ejectile.nucleons);
+    if (!particles.found || target == NuclideIndex::notFound || residual == NuclideIndex::notFound) {
+        qValue = std::numeric_limits<double>::quiet_NaN();
+        if (uncertainty) *uncertainty = qValue;
+        return;
+    }
+    qValue = (atomicMass[target] - atomicMass[residual] + particles.mass) * scale;
+    if (!uncertainty) return;
+
+    /* a nuclide in the balance more than once (the 4He of the alpha decay of 8Be, say) is one error, so its
+       coefficients are added before squaring */
+    const int rows[4] = {target, residual, particles.projectile, particles.ejectile};
+    const double coefficients[4] = {1, -1, 1, -1};
+    double variance = 0;
+    for (int term = 0; term < 4; term++) {
+        bool merged = rows[term] == masslessRow_;
+        for (int earlier = 0; earlier < term; earlier++) merged = merged || rows[earlier] == rows[term];
+        if (merged) continue;
+        double coefficient = coefficients[term];
+        for (int later = term + 1; later < 4; later++) {
+            if (rows[later] == rows[term]) coefficient += coefficients[later];
+        }
+        variance += coefficient * coefficient * atomicMassUncertainty[rows[term]] * atomicMassUncertainty[rows[term]];
+    }
+    *uncertainty = std::sqrt(variance) * scale;
+}
+
+/* one reaction on every nuclide in the table as target - the columns are read directly */
+template <typename Constants>
+void QValueCalculator::chart(const Reaction &reaction, double *qValues, double *uncertainties) const
+{
+    const std::int16_t *protons = this->table_.protons().data();
+    const std::int16_t *nucleons = this->table_.nucleons().data();
+    const Particles particles = this->particles<Constants>(reaction);
+
+    parallelFor(static_cast<std::size_t>(this->table_.size()), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t row = begin; row < end; row++) {
+            this->candidate<Constants>(reaction, particles, protons[row], nucleons[row], qValues[row], uncertainties ? uncertainties + row : nullptr);
+        }
+    }, minimumBlock_);
+}
+
+/* a list of candidates */
+template <typename Constants>
+void QValueCalculator::list(const Reaction *reactions, const int *protonNumbers, const int *nucleonNumbers, std::size_t count,
+                            double *qValues, double *uncertainties) const
+{
+    parallelFor(count, [&](std::size_t begin, std::size_t end) {
+        /* candidates usually share a reaction, so keep the particles of the last one */
+        const Reaction *cached = nullptr;
+        Particles particles = {};
+
+        for (std::size_t i = begin; i < end; i++) {
+            const Reaction &reaction = reactions[i];
+            if (!cached || std::memcmp(cached, &reaction, sizeof(Reaction)) != 0) {
+                particles = this->particles<Constants>(reaction);
+                cached = &reaction;
+            }
+            this->candidate<Constants>(reaction, particles, protonNumbers[i], nucleonNumbers[i], qValues[i], uncertainties ? uncertainties + i : nullptr);
+        }
+    }, minimumBlock_);
+}
+
+/* instantiate the calculations for each constant set - a new set needs a line here */
+#define QVALUECALCULATOR_INSTANTIATE(Constants) \
+    template void QValueCalculator::chart<Constants>(const Reaction &, double *, double *) const; \
+    template void QValueCalculator::list<Constants>(const Reaction *, const int *, const int *, std::size_t, double *, double *) const;
+
+QVALUECALCULATOR_INSTANTIATE(AccurateConstants)
+QVALUECALCULATOR_INSTANTIATE(ALevelConstants)
@@ -0,0 +1,98 @@
+#ifndef QVALUES_H
+#define QVALUES_H
+
+#include <cstddef>
+#include "constants.h"
+#include "nuclideindex.h"
+#include "nuclidetable.h"
+
+/* decay modes with a Q-value */
+enum DecayMode
+{
+    DecayAlpha,                 // (Z, A) -> (Z - 2, A - 4) + alpha
+    DecayBetaMinus,             // (Z, A) -> (Z + 1, A) + e- + antineutrino
+    DecayBetaPlus,              // (Z, A) -> (Z - 1, A) + e+ + neutrino
+    DecayElectronCapture,       // (Z, A) + e- -> (Z - 1, A) + neutrino
+    numberOfDecayModes
+};
+
+/* a light particle taking part in a reaction - A = 0 is a photon, Z = -1 an electron and Z = 1 a positron */
+struct ReactionParticle
+{
+    int protons;
+    int nucleons;
+};
+
+/*
+ * A two-body reaction target(projectile, ejectile)residual, e.g. (n,g), (p,n) or (a,n). Decays are
+ * written the same way with electrons as particles. electronMasses counts electron masses which
+ * are not already held in the atomic masses, as for the positron in beta+ decay.
+ */
+struct Reaction
+{
+    ReactionParticle projectile;
+    ReactionParticle ejectile;
+    int electronMasses;
+
+    /* returns the reaction describing a decay mode */
+    static Reaction decay(DecayMode mode);
+
+    /* read a reaction written as "(n,g)" or "p,n" - particles are g, n, p, d, t, h (3He) and a - returns false if it cannot be read */
+    static bool parse(const char *text, Reaction &reaction);
+};
+
+/*
+ * Q-values from the atomic mass column. A reaction on a target (Z, A) gives
+ * Q = M(target) + M(projectile) - M(ejectile) - M(residual) - electronMasses * me, in keV, with the
+ * uncertainty from the mass uncertainties in quadrature, a nuclide appearing twice counting once.
+ * Light particle masses are read once per call and each target costs one index lookup, so the work
+ * is split over every core. Targets or residuals which are not in the table give NaN. The
+ * uncertainty output may be null.
+ */
+class QValueCalculator
+{
+private:
+    const NuclideTable &table_;
+    const NuclideIndex &index_;
+
+    /* the light particles of one reaction - rows are masslessRow_ for photons and electrons */
+    struct Particles
+    {
+        bool found;                 // false if a particle is not in the table
+        int projectile;
+        int ejectile;
+        double mass;                // projectile - ejectile - electron masses in micro-u
+    };
+
+    static constexpr int masslessRow_ = -2;
+
+    /* returns false if a particle is not in the table */
+    bool particleRow(const ReactionParticle &particle, int &row) const;
+
+    template <typename Constants>
+    Particles particles(const Reaction &reaction) const;
+
+    /* Q-value of one reaction on target (protons, nucleons) - the uncertainty output may be null */
+    template <typename Constants>
+    void candidate(const Reaction &reaction, const Particles &particles, int protons, int nucleons,
+                   double &qValue, double *uncertainty) const;
+
+public:
+    /* the index must be built for the same table, and both must outlive the calculator */
+    QValueCalculator(const NuclideTable &table, const NuclideIndex &index);
+
+    /* one reaction on every nuclide in the table as target - the outputs line up with the table rows */
+    template <typename Constants>
+    void chart(const Reaction &reaction, double *qValues, double *uncertainties) const;
+
+    /* a list of candidates - reactions[i] on target (protonNumbers[i], nucleonNumbers[i]) */
+    template <typename Constants>
+    void list(const Reaction *reactions, const int *protonNumbers, const int *nucleonNumbers, std::size_t count,
+              double *qValues, double *uncertainties) const;
+
+    /* decay Q-values of every nuclide in the table */
+    template <typename Constants>
+    void chart(DecayMode mode, double *qValues, double *uncertainties) const { this->chart<Constants>(Reaction::decay(mode), qValues, uncertainties); }
+};
+
+#endif // QVALUES_H
@@ -0,0 +1,219 @@
+#include "semf.h"
+#include "parallel.h"
+#include <cmath>
+#include <limits>
+
+/* nuclides per chunk of the parallel passes */
+static constexpr std::size_t chunkSize_ = 512;
+
+static const char *const semfTermNames_[numberOfSemfTerms] = {
+    "Volume", "Surface", "Coulomb", "Asymmetry", "Pairing"
+};
+
+/* weighted normal equations of one chunk of nuclides - only the lower triangle of the matrix is summed */
+struct SemfNormalEquations
+{
+    double matrix[numberOfSemfTerms][numberOfSemfTerms] = {};
+    double vector[numberOfSemfTerms] = {};
+    int nuclides = 0;
+
+    void add(const SemfNormalEquations &other) {
+        for (int i = 0; i < numberOfSemfTerms; i++) {
+            for (int j = 0; j <= i; j++) this->matrix[i][j] += other.matrix[i][j];
+            this->vector[i] += other.vector[i];
+        }
+        this->nuclides += other.nuclides;
+    }
+};
+
+/* weighted and unweighted sums of squared residuals */
+struct SemfResidualSums
+{
+    double weighted = 0;
+    double unweighted = 0;
+};
+
+/* true if a nuclide belongs to the subset */
+bool SemfFilter::accepts(int protons, int neutrons, int nucleons, std::uint8_t flags) const
+{
+    if (nucleons < this->minimumNucleons || nucleons > this->maximumNucleons) return false;
+    if (this->excludeEstimated && (flags & NuclideEstimated)) return false;
+    const bool evenProtons = protons % 2 == 0;
+    const bool evenNeutrons = neutrons % 2 == 0;
+    switch (this->parity) {
+    case SemfEvenEven: return evenProtons && evenNeutrons;
+    case SemfOddA: return evenProtons != evenNeutrons;
+    case SemfOddOdd: return !evenProtons && !evenNeutrons;
+    default: return true;
+    }
+}
+
+/* constructor - no coefficients until a fit succeeds */
+SemfFit::SemfFit()
+    : chiSquared_(0)
+    , rms_(0)
+    , nuclides_(0)
+{
+    for (int term = 0; term < numberOfSemfTerms; term++) {
+        this->coefficients_[term] = 0;
+        this->uncertainties_[term] = 0;
+    }
+}
+
+/* returns the name of a term */
+const char *SemfFit::termName(SemfTerm term)
+{
+    return semfTermNames_[term];
+}
+
+/* the value of each term with unit coefficient */
+void SemfFit::terms(int protons, int nucleons, double *terms)
+{
+    const int neutrons = nucleons - protons;
+    const double a = nucleons;
+    const double cubeRoot = std::cbrt(a);
+    terms[SemfVolume] = a;
+    terms[SemfSurface] = -cubeRoot * cubeRoot;
+    terms[SemfCoulomb] = -protons * (protons - 1.0) / cubeRoot;
+    terms[SemfAsymmetry] = -static_cast<double>(neutrons - protons) * (neutrons - protons) / a;
+    if (nucleons % 2 == 1) terms[SemfPairing] = 0;
+    else if (protons % 2 == 0) terms[SemfPairing] = 1.0 / std::sqrt(a);
+    else terms[SemfPairing] = -1.0 / std::sqrt(a);
+}
+
+/* total binding energy predicted by the fit */
+double SemfFit::bindingEnergy(int protons, int nucleons) const
+{
+    double terms[numberOfSemfTerms];
+    SemfFit::terms(protons, nucleons, terms);
+    double energy = 0;
+    for (int term = 0; term < numberOfSemfTerms; term++) energy += this->coefficients_[term] * terms[term];
+    return energy;
+}
+
+/* fit the subset of the table picked by the filter */
+bool SemfFit::fit(const NuclideTable &table, const SemfFilter &filter, double minimumUncertainty)
+{
+    const std::int16_t *protons = table.protons().data();
+    const std::int16_t *neutrons = table.neutrons().data();
+    const std::int16_t *nucleons = table.nucleons().data();
+    const std::uint8_t *flags = table.flags().data();
+    const double *bindingEnergy = table.bindingEnergy().data();
+    const double *bindingEnergyUncertainty = table.bindingEnergyUncertainty().data();
+    const double minimumVariance = minimumUncertainty * minimumUncertainty;
+
+    /* weight of a nuclide - zero if it is not in the subset */
+    auto weight = [&](std::size_t row) {
+        if (nucleons[row] <= 0 || !filter.accepts(protons[row], neutrons[row], nucleons[row], flags[row])) return 0.0;
+        const double uncertainty = bindingEnergyUncertainty[row] * nucleons[row];
+        return 1.0 / (uncertainty * uncertainty + minimumVariance);
+    };
+
+    /* sum the normal equations chunk by chunk */
+    const SemfNormalEquations equations = parallelReduce(static_cast<std::size_t>(table.size()), SemfNormalEquations(),
+        [&](std::size_t begin, std::size_t end) {
+            SemfNormalEquations partial;
+            double terms[numberOfSemfTerms];
+            for (std::size_t row = begin; row < end; row++) {
+                const double w = weight(row);
+                if (w == 0) continue;
+                SemfFit::terms(protons[row], nucleons[row], terms);
+                const double energy = bindingEnergy[row] * nucleons[row];
+                for (int i = 0; i < numberOfSemfTerms; i++) {
+                    for (int j = 0; j <= i; j++) partial.matrix[i][j] += w * terms[i] * terms[j];
+                    partial.vector[i] += w * terms[i] * energy;
+                }
+                partial.nuclides++;
+            }
+            return partial;
+        },
+        [](SemfNormalEquations &total, const SemfNormalEquations &partial) { total.add(partial); }, chunkSize_);
+
+    if (equations.nuclides < numberOfSemfTerms) return false;
+
+    /* Cholesky decomposition L L^T of the normal matrix */
+    double lower[numberOfSemfTerms][numberOfSemfTerms] = {};
+    for (int i = 0; i < numberOfSemfTerms; i++) {
+        for (int j = 0; j <= i; j++) {
+            double sum = equations.matrix[i][j];
+            for (int k = 0; k < j; k++) sum -= lower[i][k] * lower[j][k];
+            if (i == j) {
+                if (sum <= 0) return false;
+                lower[i][i] = std::sqrt(sum);
+            } else {
+                lower[i][j] = sum / lower[j][j];
+            }
+        }
+    }
+
+    /* forward and back substitution for the coefficients */
+    double coefficients[numberOfSemfTerms];
+    for (int i = 0; i < numberOfSemfTerms; i++) {
+        double sum = equations.vector[i];
+        for (int k = 0; k < i; k++) sum -= lower[i][k] * coefficients[k];
+        coefficients[i] = sum / lower[i][i];
+    }
+    for (int i = numberOfSemfTerms - 1; i >= 0; i--) {
+        double sum = coefficients[i];
+        for (int k = i + 1; k < numberOfSemfTerms; k++) sum -= lower[k][i] * coefficients[k];
+        coefficients[i] = sum / lower[i][i];
+    }
+    for (int term = 0; term < numberOfSemfTerms; term++) this->coefficients_[term] = coefficients[term];
+    this->nuclides_ = equations.nuclides;
+
+    /* fit quality over the subset */
+    const SemfResidualSums sums = parallelReduce(static_cast<std::size_t>(table.size()), SemfResidualSums(),
+        [&](std::size_t begin, std::size_t end) {
+            SemfResidualSums partial;
+            for (std::size_t row = begin; row < end; row++) {
+                const double w = weight(row);
+                if (w == 0) continue;
+                const double residual = bindingEnergy[row] * nucleons[row] - this->bindingEnergy(protons[row], nucleons[row]);
+                partial.weighted += w * residual * residual;
+                partial.unweighted += residual * residual;
+            }
+            return partial;
+        },
+        [](SemfResidualSums &total, const SemfResidualSums &partial) {
+            total.weighted += partial.weighted;
+            total.unweighted += partial.unweighted;
+        }, chunkSize_);
+    this->chiSquared_ = sums.weighted;
+    this->rms_ = std::sqrt(sums.unweighted / equations.nuclides);
+
+    /* coefficient uncertainties from the diagonal of the inverse normal matrix, scaled by the Birge ratio
+       since the liquid drop model error is far larger than the AME uncertainties */
+    const int degreesOfFreedom = equations.nuclides - numberOfSemfTerms;
+    const double birge = degreesOfFreedom > 0 ? std::sqrt(this->chiSquared_ / degreesOfFreedom) : 1.0;
+    for (int column = 0; column < numberOfSemfTerms; column++) {
+        /* solve L y = e_column - the diagonal element of the inverse is |y|^2 */
+        double y[numberOfSemfTerms] = {};
+        double variance = 0;
+        for (int i = column; i < numberOfSemfTerms; i++) {
+            double sum = i == column ? 1.0 : 0.0;
+            for (int k = column; k < i; k++) sum -= lower[i][k] * y[k];
+            y[i] = sum / lower[i][i];
+            variance += y[i] * y[i];
+        }
+        this->uncertainties_[column] = std::sqrt(variance) * birge;
+    }
+    return true;
+}
+
+/* experimental minus fitted total binding energy for every row of the table */
+void SemfFit::residuals(const NuclideTable &table, double *out) const
+{
+    const std::int16_t *protons = table.protons().data();
+    const std::int16_t *nucleons = table.nucleons().data();
+    const double *bindingEnergy = table.bindingEnergy().data();
+
+    parallelFor(static_cast<std::size_t>(table.size()), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t row = begin; row < end; row++) {
+            if (nucleons[row] <= 0) {
+                out[row] = std::numeric_limits<double>::quiet_NaN();
+                continue;
+            }
+            out[row] = bindingEnergy[row] * nucleons[row] - this->bindingEnergy(protons[row], nucleons[row]);
+        }
+    }, chunkSize_);
+}
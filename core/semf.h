@@ -0,0 +1,84 @@
+#ifndef SEMF_H
+#define SEMF_H
+
+#include <climits>
+#include <cstdint>
+#include "nuclidetable.h"
+
+/* terms of the semi-empirical mass formula */
+enum SemfTerm
+{
+    SemfVolume,         // a_V A
+    SemfSurface,        // -a_S A^(2/3)
+    SemfCoulomb,        // -a_C Z (Z - 1) / A^(1/3)
+    SemfAsymmetry,      // -a_A (N - Z)^2 / A
+    SemfPairing,        // +a_P / A^(1/2) for even-even, -a_P / A^(1/2) for odd-odd, 0 for odd A
+    numberOfSemfTerms
+};
+
+/* nuclide parity classes a fit can be restricted to */
+enum SemfParity
+{
+    SemfAllParities,
+    SemfEvenEven,
+    SemfOddA,
+    SemfOddOdd
+};
+
+/* the subset of the table used in a fit */
+struct SemfFilter
+{
+    SemfParity parity = SemfAllParities;
+    int minimumNucleons = 1;
+    int maximumNucleons = INT_MAX;
+    bool excludeEstimated = false;
+
+    /* true if a nuclide belongs to the subset */
+    bool accepts(int protons, int neutrons, int nucleons, std::uint8_t flags) const;
+};
+
+/*
+ * Bethe-Weizsacker (liquid drop) fit of total binding energies. The formula is linear in its five
+ * coefficients, so a fit is one weighted least squares solve: the 5x5 normal equations are summed
+ * over the table in parallel and solved by Cholesky decomposition. Weights are 1 / sigma^2 from the
+ * AME binding energy uncertainties, with minimumUncertainty added in quadrature so exactly known
+ * nuclides such as 12C do not take over the fit. Energies are in keV.
+ */
+class SemfFit
+{
+private:
+    double coefficients_[numberOfSemfTerms];
+    double uncertainties_[numberOfSemfTerms];
+    double chiSquared_;
+    double rms_;
+    int nuclides_;
+
+public:
+    SemfFit();
+
+    /* fit the subset of the table picked by the filter - returns false if there are too few nuclides */
+    bool fit(const NuclideTable &table, const SemfFilter &filter = SemfFilter(), double minimumUncertainty = 1.0);
+
+    /* fitted coefficients in keV and their standard uncertainties */
+    double coefficient(SemfTerm term) const { return this->coefficients_[term]; }
+    double uncertainty(SemfTerm term) const { return this->uncertainties_[term]; }
+
+    /* fit quality - weighted chi squared and the unweighted rms residual in keV over the fitted nuclides */
+    double chiSquared() const { return this->chiSquared_; }
+    double rms() const { return this->rms_; }
+    int nuclides() const { return this->nuclides_; }
+
+    /* total binding energy predicted by the fit */
+    double bindingEnergy(int protons, int nucleons) const;
+
+    /* experimental minus fitted total binding energy for every row of the table, computed in parallel */
+    void residuals(const NuclideTable &table, double *out) const;
+
+    /* the value of each term with unit coefficient - terms must have room for numberOfSemfTerms values */
+    static void terms(int protons, int nucleons, double *terms);
+
+    /* returns the name of a term */
+    static const char *termName(SemfTerm term);
+};
+
+#endif // SEMF_H
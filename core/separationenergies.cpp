@@ -0,0 +1,116 @@
+#include "separationenergies.h"
+#include <cmath>
+#include <limits>
+
+/* proton and neutron numbers removed by each channel */
+struct SeparationShift
+{
+    int protons;
+    int neutrons;
+};
+
+static constexpr SeparationShift separationShifts_[numberOfSeparationChannels] = {
+    {0, 1},     // S_n
+    {1, 0},     // S_p
+    {0, 2},     // S_2n
+    {2, 0},     // S_2p
+    {2, 2}      // S_alpha
+};
+
+static const char *const separationChannelNames_[numberOfSeparationChannels] = {
+    "Sn", "Sp", "S2n", "S2p", "Sa"
+};
+
+/* constructor - no energies until compute is called */
+SeparationEnergies::SeparationEnergies()
+    : size_(0)
+{
+}
+
+/* returns a short name of a channel */
+const char *SeparationEnergies::channelName(SeparationChannel channel)
+{
+    return separationChannelNames_[channel];
+}
+
+/* mass of a removed particle in micro-u and its row - false if the particle is not in the table */
+static bool particleMass(const NuclideTable &table, const NuclideIndex &index, int protons, int nucleons, double &mass, int &row)
+{
+    row = index.find(protons, nucleons);
+    if (row == NuclideIndex::notFound) return false;
+    mass = table.atomicMass()[row];
+    return true;
+}
+
+/* variance of coefficient-weighted masses - a nuclide appearing in several terms (the alpha in 8Be, say)
+   has its coefficients added before squaring as its mass errors are the same error */
+static double massVariance(const int (&rows)[3], const double (&coefficients)[3], const double *uncertainty)
+{
+    double variance = 0;
+    for (int term = 0; term < 3; term++) {
+        bool merged = false;
+        for (int earlier = 0; earlier < term; earlier++) merged = merged || rows[earlier] == rows[term];
+        if (merged) continue;
+        double coefficient = coefficients[term];
+        for (int later = term + 1; later < 3; later++) {
+            if (rows[later] == rows[term]) coefficient += coefficients[later];
+        }
+        variance += coefficient * coefficient * uncertainty[rows[term]] * uncertainty[rows[term]];
+    }
+    return variance;
+}
+
+/* compute every channel for every nuclide in the table */
+template <typename Constants>
+void SeparationEnergies::compute(const NuclideTable &table, const NuclideIndex &index)
+{
+    const int count = table.size();
+    const double notAvailable = std::numeric_limits<double>::quiet_NaN();
+    const std::int16_t *protons = table.protons().data();
+    const std::int16_t *neutrons = table.neutrons().data();
+    const double *atomicMass = table.atomicMass().data();
+    const double *atomicMassUncertainty = table.atomicMassUncertainty().data();
+
+    /* micro-u to keV */
+    const double scale = 1.0e-6 * Constants::amutokeV;
+
+    /* removed particle masses per channel - the same masses QValueCalculator uses for n, p and a */
+    double neutronMass = 0, hydrogenMass = 0, heliumMass = 0;
+    int neutronRow = 0, hydrogenRow = 0, heliumRow = 0;
+    const bool neutronFound = particleMass(table, index, 0, 1, neutronMass, neutronRow);
+    const bool hydrogenFound = particleMass(table, index, 1, 1, hydrogenMass, hydrogenRow);
+    const bool heliumFound = particleMass(table, index, 2, 4, heliumMass, heliumRow);
+    const bool particleFound[numberOfSeparationChannels] = {neutronFound, hydrogenFound, neutronFound, hydrogenFound, heliumFound};
+    const double particle[numberOfSeparationChannels] = {neutronMass, hydrogenMass, 2 * neutronMass, 2 * hydrogenMass, heliumMass};
+    const int particleRow[numberOfSeparationChannels] = {neutronRow, hydrogenRow, neutronRow, hydrogenRow, heliumRow};
+    const double particleCount[numberOfSeparationChannels] = {1, 1, 2, 2, 1};
+
+    for (int channel = 0; channel < numberOfSeparationChannels; channel++) {
+        this->energies_[channel].resize(count);
+        this->uncertainties_[channel].resize(count);
+    }
+    this->size_ = count;
+
+    /* one pass over the rows filling every channel */
+    for (int row = 0; row < count; row++) {
+        for (int channel = 0; channel < numberOfSeparationChannels; channel++) {
+            const SeparationShift &shift = separationShifts_[channel];
+            const int neighbour = index.findByNeutrons(protons[row] - shift.protons, neutrons[row] - shift.neutrons);
+            if (!particleFound[channel] || neighbour == NuclideIndex::notFound) {
+                this->energies_[channel][row] = notAvailable;
+                this->uncertainties_[channel][row] = notAvailable;
+                continue;
+            }
+            /* written as the Q-value of the capture on the neighbour, in the same order as QValueCalculator */
+            this->energies_[channel][row] = (atomicMass[neighbour] - atomicMass[row] + particle[channel]) * scale;
+            const int rows[3] = {neighbour, row, particleRow[channel]};
+            const double coefficients[3] = {1, -1, particleCount[channel]};
+            const double variance = massVariance(rows, coefficients, atomicMassUncertainty);
+            this->uncertainties_[channel][row] = std::sqrt(variance) * scale;
+        }
+    }
+}
+
+/* instantiate the calculation for each constant set - a new set needs a line here */
+template void SeparationEnergies::compute<AccurateConstants>(const NuclideTable &, const NuclideIndex &);
+template void SeparationEnergies::compute<ALevelConstants>(const NuclideTable &, const NuclideIndex &);
@@ -0,0 +1,53 @@
+#ifndef SEPARATIONENERGIES_H
+#define SEPARATIONENERGIES_H
+
+#include <vector>
+#include "constants.h"
+#include "nuclideindex.h"
+#include "nuclidetable.h"
+
+/* the separation energies computed for every nuclide */
+enum SeparationChannel
+{
+    SeparationNeutron,          // S_n = M(Z, N - 1) + M(n) - M(Z, N)
+    SeparationProton,           // S_p = M(Z - 1, N) + M(1H) - M(Z, N)
+    SeparationTwoNeutron,       // S_2n = M(Z, N - 2) + 2 M(n) - M(Z, N)
+    SeparationTwoProton,        // S_2p = M(Z - 2, N) + 2 M(1H) - M(Z, N)
+    SeparationAlpha,            // S_alpha = M(Z - 2, N - 2) + M(4He) - M(Z, N)
+    numberOfSeparationChannels
+};
+
+/*
+ * Separation energies for a whole nuclide table in one pass, from the atomic mass column. Every
+ * channel is a mass difference with a neighbour found through the (Z, N) index plus the masses of
+ * the removed neutrons, hydrogen atoms or 4He atom, read from the table. Results are in keV and
+ * line up with the table rows, and are the Q-values QValueCalculator gives for the inverse capture
+ * reactions, e.g. S_n of (Z, N) is Q of (n,g) on (Z, N - 1). Uncertainties combine the mass
+ * uncertainties in quadrature, treating the nuclides as uncorrelated. A channel whose neighbour or
+ * particle is not in the table is NaN.
+ */
+class SeparationEnergies
+{
+private:
+    std::vector<double> energies_[numberOfSeparationChannels];
+    std::vector<double> uncertainties_[numberOfSeparationChannels];
+    int size_;
+
+public:
+    SeparationEnergies();
+
+    /* compute every channel for every nuclide in the table - the index must be built for the same table */
+    template <typename Constants>
+    void compute(const NuclideTable &table, const NuclideIndex &index);
+
+    int size() const { return this->size_; }
+
+    /* separation energies and their uncertainties in keV, one per table row */
+    ColumnSpan<double> energy(SeparationChannel channel) const { return ColumnSpan<double>(this->energies_[channel].data(), this->size_); }
+    ColumnSpan<double> uncertainty(SeparationChannel channel) const { return ColumnSpan<double>(this->uncertainties_[channel].data(), this->size_); }
+
+    /* returns a short name of a channel, e.g. "S2n" */
+    static const char *channelName(SeparationChannel channel);
+};
+
+#endif // SEPARATIONENERGIES_H
@@ -0,0 +1,296 @@
+#include "uncertainty.h"
+#include "parallel.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+/* samples summed together before the partial sums are combined - fixed so the result does not depend on the thread count */
+static constexpr int samplesPerBlock_ = 1024;
+
+/* row used for photons and electrons, which add nothing to the atomic masses */
+static constexpr int massless_ = -2;
+
+/* splitmix64 finaliser - a strong 64 bit mixing function */
+static inline std::uint64_t mix(std::uint64_t x)
+{
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+/* a pair of independent standard normal draws for (seed, nuclide, pair of samples) by the Marsaglia polar form of
+   the Box-Muller transform, which avoids the trigonometric functions - rejected points hash again, so the draw is
+   still fixed by its arguments */
+static inline void normalPair(std::uint64_t seed, int row, int pair, double &first, double &second)
+{
+    std::uint64_t h1 = mix(mix(mix(seed) ^ static_cast<std::uint64_t>(row)) ^ static_cast<std::uint64_t>(pair));
+    for (;;) {
+        const std::uint64_t h2 = mix(h1);
+        const double x = static_cast<double>(h1 >> 11) * 0x1.0p-52 - 1.0;     // [-1, 1)
+        const double y = static_cast<double>(h2 >> 11) * 0x1.0p-52 - 1.0;
+        const double radiusSquared = x * x + y * y;
+        if (radiusSquared > 0 && radiusSquared < 1) {
+            const double factor = std::sqrt(-2.0 * std::log(radiusSquared) / radiusSquared);
+            first = x * factor;
+            second = y * factor;
+            return;
+        }
+        h1 = mix(h2);
+    }
+}
+
+/* value and standard uncertainty of the input of a row */
+static inline void inputValue(const NuclideTable &table, UncertaintyInput input, int row, double &value, double &uncertainty)
+{
+    if (input == UncertaintyAtomicMass) {
+        value = table.atomicMass()[row];
+        uncertainty = table.atomicMassUncertainty()[row];
+    } else {
+        const int nucleons = table.nucleons()[row];
+        value = table.bindingEnergy()[row] * nucleons;
+        uncertainty = table.bindingEnergyUncertainty()[row] * nucleons;
+    }
+}
+
+/* a quantity with no value */
+static LinearQuantity unavailable()
+{
+    LinearQuantity quantity = {};
+    quantity.terms = -1;
+    return quantity;
+}
+
+/* add coefficient * input of a row to a quantity - a row already in the quantity has its coefficient added to, so a
+   nuclide used twice (the 4He in the alpha decay of 8Be, say) is one input with one error rather than two independent ones */
+static void addTerm(LinearQuantity &value, int row, double coefficient)
+{
+    for (int term = 0; term < value.terms; term++) {
+        if (value.rows[term] == row) {
+            value.coefficients[term] += coefficient;
+            return;
+        }
+    }
+    value.rows[value.terms] = row;
+    value.coefficients[value.terms++] = coefficient;
+}
+
+/* constructor - every value starts unavailable */
+DerivedQuantity::DerivedQuantity(UncertaintyInput input, int size)
+    : input_(input)
+    , values_(static_cast<std::size_t>(size), unavailable())
+{
+}
+
+/* nuclear mass defect in u - the a-level set subtracts the nuclear mass from the proton masses, which is the same as
+   using a hydrogen mass of proton plus electron mass */
+template <typename Constants>
+DerivedQuantity DerivedQuantity::massDefect(const NuclideTable &table)
+{
+    DerivedQuantity quantity(UncertaintyAtomicMass, table.size());
+    double hydrogenMass;
+    if constexpr (Constants::hydrogenMassDefect) hydrogenMass = Constants::hydrogenMass;
+    else hydrogenMass = Constants::protonMass + Constants::electronMass;
+
+    for (int row = 0; row < table.size(); row++) {
+        LinearQuantity &value = quantity.values_[row];
+        value.terms = 1;
+        value.rows[0] = row;
+        value.coefficients[0] = -1.0e-6;
+        value.constant = table.protons()[row] * hydrogenMass + table.neutrons()[row] * Constants::neutronMass;
+    }
+    return quantity;
+}
+
+/* total binding energy in keV */
+template <typename Constants>
+DerivedQuantity DerivedQuantity::bindingEnergy(const NuclideTable &table)
+{
+    DerivedQuantity quantity = DerivedQuantity::massDefect<Constants>(table);
+    for (LinearQuantity &value : quantity.values_) {
+        value.coefficients[0] *= Constants::amutokeV;
+        value.constant *= Constants::amutokeV;
+    }
+    return quantity;
+}
+
+/* separation energy in keV - the same mass balance as SeparationEnergies, with the removed neutrons, 1H atoms or 4He
+   atom as one term each */
+template <typename Constants>
+DerivedQuantity DerivedQuantity::separationEnergy(const NuclideTable &table, const NuclideIndex &index, SeparationChannel channel)
+{
+    static constexpr int removedProtons[numberOfSeparationChannels] = {0, 1, 0, 2, 2};
+    static constexpr int removedNeutrons[numberOfSeparationChannels] = {1, 0, 2, 0, 2};
+    static constexpr int particleProtons[numberOfSeparationChannels] = {0, 1, 0, 1, 2};
+    static constexpr int particleNucleons[numberOfSeparationChannels] = {1, 1, 1, 1, 4};
+    static constexpr int particleCount[numberOfSeparationChannels] = {1, 1, 2, 2, 1};
+    DerivedQuantity quantity(UncertaintyAtomicMass, table.size());
+    const double scale = 1.0e-6 * Constants::amutokeV;
+
+    const int particle = index.find(particleProtons[channel], particleNucleons[channel]);
+    if (particle == NuclideIndex::notFound) return quantity;
+
+    for (int row = 0; row < table.size(); row++) {
+        const int neighbour = index.findByNeutrons(table.protons()[row] - removedProtons[channel], table.neutrons()[row] - removedNeutrons[channel]);
+        if (neighbour == NuclideIndex::notFound) continue;
+
+        LinearQuantity &value = quantity.values_[row];
+        value.terms = 0;
+        addTerm(value, neighbour, scale);
+        addTerm(value, row, -scale);
+        addTerm(value, particle, particleCount[channel] * scale);
+        value.constant = 0;
+    }
+    return quantity;
+}
+
+/* Q-value in keV - the same mass balance as QValueCalculator */
+template <typename Constants>
+DerivedQuantity DerivedQuantity::qValue(const NuclideTable &table, const NuclideIndex &index, const Reaction &reaction)
+{
+    DerivedQuantity quantity(UncertaintyAtomicMass, table.size());
+    const double scale = 1.0e-6 * Constants::amutokeV;
+
+    const int projectile = reaction.projectile.nucleons > 0 ? index.find(reaction.projectile.protons, reaction.projectile.nucleons) : massless_;
+    const int ejectile = reaction.ejectile.nucleons > 0 ? index.find(reaction.ejectile.protons, reaction.ejectile.nucleons) : massless_;
+    if (projectile == NuclideIndex::notFound || ejectile == NuclideIndex::notFound) return quantity;
+
+    for (int row = 0; row < table.size(); row++) {
+        const int residual = index.find(table.protons()[row] + reaction.projectile.protons - reaction.ejectile.protons,
+                                        table.nucleons()[row] + reaction.projectile.nucleons - reaction.ejectile.nucleons);
+        if (residual == NuclideIndex::notFound) continue;
+
+        LinearQuantity &value = quantity.values_[row];
+        value.terms = 0;
+        addTerm(value, row, scale);
+        addTerm(value, residual, -scale);
+        if (projectile != massless_) addTerm(value, projectile, scale);
+        if (ejectile != massless_) addTerm(value, ejectile, -scale);
+        value.constant = -reaction.electronMasses * Constants::electronMass * Constants::amutokeV;
+    }
+    return quantity;
+}
+
+/* standard normal draw number sample for a nuclide */
+double UncertaintyPropagator::normal(std::uint64_t seed, int row, int sample)
+{
+    double first, second;
+    normalPair(seed, row, sample / 2, first, second);
+    return sample % 2 == 0 ? first : second;
+}
+
+/* first order propagation */
+void UncertaintyPropagator::linear(const NuclideTable &table, const DerivedQuantity &quantity, double *values, double *uncertainties)
+{
+    const double notAvailable = std::numeric_limits<double>::quiet_NaN();
+    for (int row = 0; row < quantity.size(); row++) {
+        const LinearQuantity &linear = quantity[row];
+        if (linear.terms < 0) {
+            values[row] = notAvailable;
+            uncertainties[row] = notAvailable;
+            continue;
+        }
+        double value = linear.constant;
+        double variance = 0;
+        for (int term = 0; term < linear.terms; term++) {
+            double input, uncertainty;
+            inputValue(table, quantity.input(), linear.rows[term], input, uncertainty);
+            value += linear.coefficients[term] * input;
+            variance += linear.coefficients[term] * linear.coefficients[term] * uncertainty * uncertainty;
+        }
+        values[row] = value;
+        uncertainties[row] = std::sqrt(variance);
+    }
+}
+
+/* sums of the sample deviations from the nominal value for one block of samples */
+struct MonteCarloSums
+{
+    std::vector<double> sum;
+    std::vector<double> sumOfSquares;
+};
+
+/* Monte Carlo propagation */
+void UncertaintyPropagator::monteCarlo(const NuclideTable &table, const DerivedQuantity &quantity, int samples, std::uint64_t seed,
+                                       double *means, double *standardDeviations, unsigned threads)
+{
+    const int rows = table.size();
+    const int outputs = quantity.size();
+    const int pairs = (samples + 1) / 2;
+    const int pairsPerBlock = samplesPerBlock_ / 2;
+
+    /* nominal values - the samples are summed as deviations from these to keep the sums accurate */
+    std::vector<double> nominal(outputs), linearUncertainty(outputs);
+    UncertaintyPropagator::linear(table, quantity, nominal.data(), linearUncertainty.data());
+
+    std::vector<double> uncertainty(rows);
+    for (int row = 0; row < rows; row++) {
+        double value;
+        inputValue(table, quantity.input(), row, value, uncertainty[row]);
+    }
+
+    MonteCarloSums identity;
+    identity.sum.assign(outputs, 0.0);
+    identity.sumOfSquares.assign(outputs, 0.0);
+
+    /* each block draws every nuclide once per sample and evaluates every output */
+    const MonteCarloSums sums = parallelReduce(static_cast<std::size_t>(pairs), identity,
+        [&](std::size_t begin, std::size_t end) {
+            MonteCarloSums partial = identity;
+            std::vector<double> first(rows), second(rows);
+            for (std::size_t pair = begin; pair < end; pair++) {
+                for (int row = 0; row < rows; row++) {
+                    normalPair(seed, row, static_cast<int>(pair), first[row], second[row]);
+                    first[row] *= uncertainty[row];
+                    second[row] *= uncertainty[row];
+                }
+                const bool useSecond = static_cast<int>(2 * pair + 1) < samples;
+                for (int output = 0; output < outputs; output++) {
+                    const LinearQuantity &linear = quantity[output];
+                    if (linear.terms < 0) continue;
+                    double deviation = 0;
+                    double deviationSecond = 0;
+                    for (int term = 0; term < linear.terms; term++) {
+                        deviation += linear.coefficients[term] * first[linear.rows[term]];
+                        deviationSecond += linear.coefficients[term] * second[linear.rows[term]];
+                    }
+                    partial.sum[output] += deviation;
+                    partial.sumOfSquares[output] += deviation * deviation;
+                    if (useSecond) {
+                        partial.sum[output] += deviationSecond;
+                        partial.sumOfSquares[output] += deviationSecond * deviationSecond;
+                    }
+                }
+            }
+            return partial;
+        },
+        [outputs](MonteCarloSums &total, const MonteCarloSums &partial) {
+            for (int output = 0; output < outputs; output++) {
+                total.sum[output] += partial.sum[output];
+                total.sumOfSquares[output] += partial.sumOfSquares[output];
+            }
+        }, static_cast<std::size_t>(pairsPerBlock), threads);
+
+    const double notAvailable = std::numeric_limits<double>::quiet_NaN();
+    for (int output = 0; output < outputs; output++) {
+        if (quantity[output].terms < 0 || samples < 2) {
+            means[output] = notAvailable;
+            standardDeviations[output] = notAvailable;
+            continue;
+        }
+        const double mean = sums.sum[output] / samples;
+        const double variance = (sums.sumOfSquares[output] - sums.sum[output] * mean) / (samples - 1);
+        means[output] = nominal[output] + mean;
+        standardDeviations[output] = std::sqrt(std::max(variance, 0.0));
+    }
+}
+
+/* instantiate the quantities for each constant set - a new set needs a line here */
+#define DERIVEDQUANTITY_INSTANTIATE(Constants) \
+    template DerivedQuantity DerivedQuantity::massDefect<Constants>(const NuclideTable &); \
+    template DerivedQuantity DerivedQuantity::bindingEnergy<Constants>(const NuclideTable &); \
+    template DerivedQuantity DerivedQuantity::separationEnergy<Constants>(const NuclideTable &, const NuclideIndex &, SeparationChannel); \
+    template DerivedQuantity DerivedQuantity::qValue<Constants>(const NuclideTable &, const NuclideIndex &, const Reaction &);
+
+DERIVEDQUANTITY_INSTANTIATE(AccurateConstants)
+DERIVEDQUANTITY_INSTANTIATE(ALevelConstants)
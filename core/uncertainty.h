@@ -0,0 +1,89 @@
+#ifndef UNCERTAINTY_H
+#define UNCERTAINTY_H
+
+#include <cstdint>
+#include <vector>
+#include "constants.h"
+#include "nuclideindex.h"
+#include "nuclidetable.h"
+#include "qvalues.h"
+#include "separationenergies.h"
+
+/* the AME column a derived quantity is built from */
+enum UncertaintyInput
+{
+    UncertaintyAtomicMass,          // atomic mass in micro-u
+    UncertaintyBindingEnergy        // total binding energy in keV, i.e. the per nucleon column times A
+};
+
+/* one derived value written as constant + sum of coefficient * input over up to four nuclides */
+struct LinearQuantity
+{
+    static constexpr int maximumTerms = 4;
+
+    int terms;                      // -1 if the value is not available
+    int rows[maximumTerms];
+    double coefficients[maximumTerms];
+    double constant;
+};
+
+/*
+ * A derived quantity for every row of a table in a form the uncertainty engine can propagate.
+ * Mass defects, binding energies, separation energies and Q-values are all linear in the AME
+ * masses or binding energies, so each is stored as the nuclides it depends on and their
+ * coefficients.
+ */
+class DerivedQuantity
+{
+private:
+    UncertaintyInput input_;
+    std::vector<LinearQuantity> values_;
+
+    DerivedQuantity(UncertaintyInput input, int size);
+
+public:
+    UncertaintyInput input() const { return this->input_; }
+    int size() const { return static_cast<int>(this->values_.size()); }
+    const LinearQuantity &operator[](int row) const { return this->values_[row]; }
+
+    /* nuclear mass defect in u */
+    template <typename Constants>
+    static DerivedQuantity massDefect(const NuclideTable &table);
+
+    /* total binding energy in keV */
+    template <typename Constants>
+    static DerivedQuantity bindingEnergy(const NuclideTable &table);
+
+    /* separation energy in keV - the same mass balance as SeparationEnergies */
+    template <typename Constants>
+    static DerivedQuantity separationEnergy(const NuclideTable &table, const NuclideIndex &index, SeparationChannel channel);
+
+    /* Q-value in keV of a reaction or decay with every nuclide as target */
+    template <typename Constants>
+    static DerivedQuantity qValue(const NuclideTable &table, const NuclideIndex &index, const Reaction &reaction);
+};
+
+/*
+ * Uncertainty propagation for derived quantities, treating the AME uncertainties as independent.
+ * The linear mode gives the first order result directly. The Monte Carlo mode draws every input
+ * from a normal distribution and returns the sample mean and standard deviation. Draws come from
+ * a counter-based generator - a hash of (seed, nuclide, sample) - so a nuclide has the same value
+ * in a given sample wherever it is used, which keeps the correlation between neighbouring
+ * quantities, and the samples are summed in fixed blocks, so the result is the same bit for bit
+ * for any number of threads. Unavailable values give NaN.
+ */
+class UncertaintyPropagator
+{
+public:
+    /* first order propagation */
+    static void linear(const NuclideTable &table, const DerivedQuantity &quantity, double *values, double *uncertainties);
+
+    /* Monte Carlo propagation with the given number of samples - threads = 0 uses every core */
+    static void monteCarlo(const NuclideTable &table, const DerivedQuantity &quantity, int samples, std::uint64_t seed,
+                           double *means, double *standardDeviations, unsigned threads = 0);
+
+    /* standard normal draw number sample for a nuclide - the same arguments always give the same value */
+    static double normal(std::uint64_t seed, int row, int sample);
+};
+
+#endif // UNCERTAINTY_H